@@ -0,0 +1,39 @@
+#include <emscripten/bind.h>
+#include "memory/allocator.h"
+
+using namespace emscripten;
+
+EMSCRIPTEN_BINDINGS(memory_allocator_module) {
+    value_object<AllocEvent>("AllocEvent")
+        .field("type", &AllocEvent::type)
+        .field("id", &AllocEvent::id)
+        .field("size", &AllocEvent::size);
+
+    value_object<AllocSample>("AllocSample")
+        .field("event", &AllocSample::event)
+        .field("requested", &AllocSample::requested)
+        .field("reserved", &AllocSample::reserved)
+        .field("free_blocks", &AllocSample::free_blocks)
+        .field("largest_free", &AllocSample::largest_free)
+        .field("external_fragmentation", &AllocSample::external_fragmentation)
+        .field("internal_fragmentation", &AllocSample::internal_fragmentation)
+        .field("mean_search_length", &AllocSample::mean_search_length)
+        .field("failures", &AllocSample::failures);
+
+    register_vector<AllocEvent>("vector<AllocEvent>");
+    register_vector<AllocSample>("vector<AllocSample>");
+
+    value_object<AllocatorResult>("AllocatorResult")
+        .field("samples", &AllocatorResult::samples)
+        .field("allocations", &AllocatorResult::allocations)
+        .field("frees", &AllocatorResult::frees)
+        .field("failures", &AllocatorResult::failures)
+        .field("peak_requested", &AllocatorResult::peak_requested)
+        .field("peak_reserved", &AllocatorResult::peak_reserved)
+        .field("mean_search_length", &AllocatorResult::mean_search_length)
+        .field("max_search_length", &AllocatorResult::max_search_length);
+
+    class_<AllocatorSimulator>("AllocatorSimulator")
+        .constructor<>()
+        .function("simulate", &AllocatorSimulator::simulate);
+}
@@ -0,0 +1,17 @@
+#include <emscripten/bind.h>
+#include "deadlock/banker.h"
+
+using namespace emscripten;
+
+EMSCRIPTEN_BINDINGS(banker_module) {
+    value_object<BankerResult>("BankerResult")
+        .field("is_safe", &BankerResult::is_safe)
+        .field("safe_sequence", &BankerResult::safe_sequence);
+        
+    register_vector<int>("vector<int>");
+    // Nested vectors are avoided in interface for simplicity.
+
+    class_<Banker>("Banker")
+        .constructor<>()
+        .function("solve", &Banker::solve);
+}
@@ -0,0 +1,46 @@
+#include <emscripten/bind.h>
+#include "disk/disk_scheduling.h"
+
+using namespace emscripten;
+
+EMSCRIPTEN_BINDINGS(disk_module) {
+    value_object<DiskResult>("DiskResult")
+        .field("seek_sequence", &DiskResult::seek_sequence)
+        .field("total_seek_count", &DiskResult::total_seek_count);
+
+    value_object<DiskComparison>("DiskComparison")
+        .field("fcfs", &DiskComparison::fcfs)
+        .field("sstf", &DiskComparison::sstf)
+        .field("scan", &DiskComparison::scan)
+        .field("c_scan", &DiskComparison::c_scan)
+        .field("look", &DiskComparison::look)
+        .field("c_look", &DiskComparison::c_look);
+
+    value_object<SeekSummary>("SeekSummary")
+        .field("total_seek", &SeekSummary::total_seek)
+        .field("moves", &SeekSummary::moves)
+        .field("max_seek", &SeekSummary::max_seek)
+        .field("mean_seek", &SeekSummary::mean_seek)
+        .field("reversals", &SeekSummary::reversals);
+
+    register_vector<int>("vector<int>");
+
+    class_<SeekTrace>("SeekTrace")
+        .function("start", &SeekTrace::start)
+        .function("summary", &SeekTrace::summary)
+        .function("run_count", &SeekTrace::run_count)
+        .function("runs_data", &SeekTrace::runs_data)
+        .function("decode", &SeekTrace::decode);
+
+    class_<DiskScheduler>("DiskScheduler")
+        .constructor<>()
+        .function("fcfs", &DiskScheduler::fcfs)
+        .function("sstf", &DiskScheduler::sstf)
+        .function("scan", &DiskScheduler::scan)
+        .function("c_scan", &DiskScheduler::c_scan)
+        .function("look", &DiskScheduler::look)
+        .function("c_look", &DiskScheduler::c_look)
+        .function("compare_all", &DiskScheduler::compare_all)
+        .function("trace", &DiskScheduler::trace)
+        .function("trace_array", &DiskScheduler::trace_array);
+}
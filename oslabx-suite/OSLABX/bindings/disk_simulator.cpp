@@ -0,0 +1,46 @@
+#include <emscripten/bind.h>
+#include "disk/disk_simulator.h"
+
+using namespace emscripten;
+
+EMSCRIPTEN_BINDINGS(disk_simulator_module) {
+    value_object<DiskRequest>("DiskRequest")
+        .field("id", &DiskRequest::id)
+        .field("arrival_time", &DiskRequest::arrival_time)
+        .field("cylinder", &DiskRequest::cylinder)
+        .field("deadline", &DiskRequest::deadline);
+
+    value_object<DiskModel>("DiskModel")
+        .field("settle_ms", &DiskModel::settle_ms)
+        .field("seek_factor_ms", &DiskModel::seek_factor_ms)
+        .field("rpm", &DiskModel::rpm)
+        .field("transfer_ms", &DiskModel::transfer_ms);
+
+    value_object<DiskCompletion>("DiskCompletion")
+        .field("id", &DiskCompletion::id)
+        .field("start_time", &DiskCompletion::start_time)
+        .field("finish_time", &DiskCompletion::finish_time)
+        .field("latency", &DiskCompletion::latency)
+        .field("missed_deadline", &DiskCompletion::missed_deadline);
+
+    value_object<DiskSimResult>("DiskSimResult")
+        .field("requests", &DiskSimResult::requests)
+        .field("mean_latency", &DiskSimResult::mean_latency)
+        .field("p50_latency", &DiskSimResult::p50_latency)
+        .field("p95_latency", &DiskSimResult::p95_latency)
+        .field("p99_latency", &DiskSimResult::p99_latency)
+        .field("max_latency", &DiskSimResult::max_latency)
+        .field("throughput", &DiskSimResult::throughput)
+        .field("utilisation", &DiskSimResult::utilisation)
+        .field("mean_seek_distance", &DiskSimResult::mean_seek_distance)
+        .field("missed_deadlines", &DiskSimResult::missed_deadlines);
+
+    register_vector<DiskRequest>("vector<DiskRequest>");
+    register_vector<DiskCompletion>("vector<DiskCompletion>");
+
+    function("default_disk_model", &default_disk_model);
+
+    class_<DiskSimulator>("DiskSimulator")
+        .constructor<>()
+        .function("simulate", &DiskSimulator::simulate);
+}
@@ -0,0 +1,23 @@
+#include <emscripten/bind.h>
+#include "scheduler/scheduler.h"
+
+using namespace emscripten;
+
+EMSCRIPTEN_BINDINGS(scheduler_module) {
+    value_object<Process>("Process")
+        .field("id", &Process::id)
+        .field("burst_time", &Process::burst_time)
+        .field("arrival_time", &Process::arrival_time)
+        .field("priority", &Process::priority)
+        .field("remaining_time", &Process::remaining_time)
+        .field("completion_time", &Process::completion_time)
+        .field("waiting_time", &Process::waiting_time)
+        .field("turn_around_time", &Process::turn_around_time);
+
+    register_vector<Process>("vector<Process>");
+
+    class_<Scheduler>("Scheduler")
+        .constructor<>()
+        .function("fcfs", &Scheduler::fcfs)
+        .function("fcfs_arrays", &Scheduler::fcfs_arrays);
+}
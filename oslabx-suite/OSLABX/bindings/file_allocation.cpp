@@ -0,0 +1,33 @@
+#include <emscripten/bind.h>
+#include "fileSystem/file_allocation.h"
+
+using namespace emscripten;
+
+EMSCRIPTEN_BINDINGS(file_allocation_module) {
+    value_object<FileInfo>("FileInfo")
+        .field("id", &FileInfo::id)
+        .field("size", &FileInfo::size)
+        .field("startBlock", &FileInfo::startBlock)
+        .field("length", &FileInfo::length)
+        .field("blocks", &FileInfo::blocks);
+
+    value_object<DiskBlock>("DiskBlock")
+        .field("id", &DiskBlock::id)
+        .field("fileId", &DiskBlock::fileId)
+        .field("nextBlock", &DiskBlock::nextBlock);
+
+    value_object<AllocationResult>("AllocationResult")
+        .field("disk", &AllocationResult::disk)
+        .field("files", &AllocationResult::files)
+        .field("success", &AllocationResult::success);
+
+    register_vector<int>("vector<int>");
+    register_vector<FileInfo>("vector<FileInfo>");
+    register_vector<DiskBlock>("vector<DiskBlock>");
+
+    class_<FileAllocationManager>("FileAllocationManager")
+        .constructor<>()
+        .function("contiguous", &FileAllocationManager::contiguous)
+        .function("linked", &FileAllocationManager::linked)
+        .function("indexed", &FileAllocationManager::indexed);
+}
@@ -0,0 +1,38 @@
+#include <emscripten/bind.h>
+#include "fileSystem/fs_simulator.h"
+
+using namespace emscripten;
+
+EMSCRIPTEN_BINDINGS(fs_simulator_module) {
+    value_object<FsEvent>("FsEvent")
+        .field("type", &FsEvent::type)
+        .field("file", &FsEvent::file)
+        .field("blocks", &FsEvent::blocks);
+
+    value_object<FsSample>("FsSample")
+        .field("event", &FsSample::event)
+        .field("files", &FsSample::files)
+        .field("used_blocks", &FsSample::used_blocks)
+        .field("free_blocks", &FsSample::free_blocks)
+        .field("largest_free_run", &FsSample::largest_free_run)
+        .field("external_fragmentation", &FsSample::external_fragmentation)
+        .field("mean_extents", &FsSample::mean_extents)
+        .field("fragmented_files", &FsSample::fragmented_files)
+        .field("failures", &FsSample::failures);
+
+    register_vector<FsEvent>("vector<FsEvent>");
+    register_vector<FsSample>("vector<FsSample>");
+
+    value_object<FsResult>("FsResult")
+        .field("samples", &FsResult::samples)
+        .field("creates", &FsResult::creates)
+        .field("deletes", &FsResult::deletes)
+        .field("failures", &FsResult::failures)
+        .field("relocated_blocks", &FsResult::relocated_blocks)
+        .field("defrag_passes", &FsResult::defrag_passes)
+        .field("defrag_moved_blocks", &FsResult::defrag_moved_blocks);
+
+    class_<FileSystemSimulator>("FileSystemSimulator")
+        .constructor<>()
+        .function("simulate", &FileSystemSimulator::simulate);
+}
@@ -0,0 +1,31 @@
+#include <emscripten/bind.h>
+#include "memory/fit_strategies.h"
+
+using namespace emscripten;
+
+EMSCRIPTEN_BINDINGS(memory_fit_module) {
+    value_object<MemoryBlock>("MemoryBlock")
+        .field("id", &MemoryBlock::id)
+        .field("size", &MemoryBlock::size)
+        .field("allocated", &MemoryBlock::allocated)
+        .field("process_id", &MemoryBlock::process_id);
+
+    value_object<ProcessRequest>("ProcessRequest")
+        .field("id", &ProcessRequest::id)
+        .field("size", &ProcessRequest::size)
+        .field("allocated", &ProcessRequest::allocated)
+        .field("block_id", &ProcessRequest::block_id);
+
+    value_object<AllocationResult>("AllocationResult")
+        .field("blocks", &AllocationResult::blocks)
+        .field("processes", &AllocationResult::processes);
+
+    register_vector<MemoryBlock>("vector<MemoryBlock>");
+    register_vector<ProcessRequest>("vector<ProcessRequest>");
+    
+    class_<MemoryManager>("MemoryManager")
+        .constructor<>()
+        .function("first_fit", &MemoryManager::first_fit)
+        .function("best_fit", &MemoryManager::best_fit)
+        .function("worst_fit", &MemoryManager::worst_fit);
+}
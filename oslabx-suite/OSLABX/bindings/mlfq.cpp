@@ -0,0 +1,33 @@
+#include <emscripten/bind.h>
+#include "scheduler/mlfq.h"
+
+using namespace emscripten;
+
+EMSCRIPTEN_BINDINGS(scheduler_mlfq_module) {
+    value_object<Process>("Process")
+        .field("id", &Process::id)
+        .field("burst_time", &Process::burst_time)
+        .field("arrival_time", &Process::arrival_time)
+        .field("priority", &Process::priority)
+        .field("remaining_time", &Process::remaining_time)
+        .field("completion_time", &Process::completion_time)
+        .field("waiting_time", &Process::waiting_time)
+        .field("turn_around_time", &Process::turn_around_time);
+
+    value_object<GanttSegment>("GanttSegment")
+        .field("pid", &GanttSegment::pid)
+        .field("start", &GanttSegment::start)
+        .field("end", &GanttSegment::end);
+
+    register_vector<Process>("vector<Process>");
+    register_vector<GanttSegment>("vector<GanttSegment>");
+    register_vector<int>("vector<int>");
+
+    value_object<ScheduleResult>("ScheduleResult")
+        .field("processes", &ScheduleResult::processes)
+        .field("gantt", &ScheduleResult::gantt);
+
+    class_<Scheduler>("Scheduler")
+        .constructor<>()
+        .function("mlfq", &Scheduler::mlfq);
+}
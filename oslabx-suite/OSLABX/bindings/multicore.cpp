@@ -0,0 +1,38 @@
+#include <emscripten/bind.h>
+#include "scheduler/multicore.h"
+
+using namespace emscripten;
+
+EMSCRIPTEN_BINDINGS(scheduler_multicore_module) {
+    value_object<Process>("Process")
+        .field("id", &Process::id)
+        .field("burst_time", &Process::burst_time)
+        .field("arrival_time", &Process::arrival_time)
+        .field("priority", &Process::priority)
+        .field("remaining_time", &Process::remaining_time)
+        .field("completion_time", &Process::completion_time)
+        .field("waiting_time", &Process::waiting_time)
+        .field("turn_around_time", &Process::turn_around_time);
+
+    value_object<CoreStats>("CoreStats")
+        .field("core", &CoreStats::core)
+        .field("busy_time", &CoreStats::busy_time)
+        .field("utilisation", &CoreStats::utilisation)
+        .field("dispatches", &CoreStats::dispatches)
+        .field("stolen", &CoreStats::stolen);
+
+    register_vector<Process>("vector<Process>");
+    register_vector<CoreStats>("vector<CoreStats>");
+
+    value_object<MulticoreResult>("MulticoreResult")
+        .field("processes", &MulticoreResult::processes)
+        .field("cores", &MulticoreResult::cores)
+        .field("makespan", &MulticoreResult::makespan)
+        .field("migrations", &MulticoreResult::migrations)
+        .field("balance_moves", &MulticoreResult::balance_moves)
+        .field("imbalance", &MulticoreResult::imbalance);
+
+    class_<MulticoreScheduler>("MulticoreScheduler")
+        .constructor<>()
+        .function("simulate", &MulticoreScheduler::simulate);
+}
@@ -0,0 +1,56 @@
+#include <emscripten/bind.h>
+#include "memory/page_replacement.h"
+
+using namespace emscripten;
+
+EMSCRIPTEN_BINDINGS(memory_page_module) {
+    value_object<PageStep>("PageStep")
+        .field("page", &PageStep::page)
+        .field("step", &PageStep::step)
+        .field("frames", &PageStep::frames)
+        .field("fault", &PageStep::fault);
+
+    value_object<PageEvent>("PageEvent")
+        .field("page", &PageEvent::page)
+        .field("fault", &PageEvent::fault)
+        .field("slot", &PageEvent::slot)
+        .field("evicted", &PageEvent::evicted)
+        .field("evicted_page", &PageEvent::evicted_page);
+
+    register_vector<int>("vector<int>");
+    register_vector<double>("vector<double>");
+    register_vector<PageStep>("vector<PageStep>");
+
+    value_object<MissRatioCurve>("MissRatioCurve")
+        .field("references", &MissRatioCurve::references)
+        .field("distinct_pages", &MissRatioCurve::distinct_pages)
+        .field("faults", &MissRatioCurve::faults)
+        .field("miss_ratio", &MissRatioCurve::miss_ratio);
+
+    class_<PageHistory>("PageHistory")
+        .function("size", &PageHistory::size)
+        .function("faults", &PageHistory::faults)
+        .function("event", &PageHistory::event)
+        .function("frames_at", &PageHistory::frames_at)
+        .function("step_at", &PageHistory::step_at);
+
+    class_<PageReplacement>("PageReplacement")
+        .constructor<>()
+        .function("fifo", &PageReplacement::fifo)
+        .function("lru", &PageReplacement::lru)
+        .function("optimal", &PageReplacement::optimal)
+        .function("lfu", &PageReplacement::lfu)
+        .function("mfu", &PageReplacement::mfu)
+        .function("clock", &PageReplacement::clock)
+        .function("arc", &PageReplacement::arc)
+        .function("two_queue", &PageReplacement::two_queue)
+        .function("lirs", &PageReplacement::lirs)
+        .function("lru_faults", &PageReplacement::lru_faults)
+        .function("optimal_faults", &PageReplacement::optimal_faults)
+        .function("lfu_faults", &PageReplacement::lfu_faults)
+        .function("mfu_faults", &PageReplacement::mfu_faults)
+        .function("faults", &PageReplacement::faults)
+        .function("lru_curve", &PageReplacement::lru_curve)
+        .function("optimal_curve", &PageReplacement::optimal_curve)
+        .function("history", &PageReplacement::history);
+}
@@ -0,0 +1,34 @@
+#include <emscripten/bind.h>
+#include "scheduler/batch.h"
+
+using namespace emscripten;
+
+EMSCRIPTEN_BINDINGS(scheduler_sweep_module) {
+    value_object<Process>("Process")
+        .field("id", &Process::id)
+        .field("burst_time", &Process::burst_time)
+        .field("arrival_time", &Process::arrival_time)
+        .field("priority", &Process::priority)
+        .field("remaining_time", &Process::remaining_time)
+        .field("completion_time", &Process::completion_time)
+        .field("waiting_time", &Process::waiting_time)
+        .field("turn_around_time", &Process::turn_around_time);
+
+    value_object<SweepMetrics>("SweepMetrics")
+        .field("workload", &SweepMetrics::workload)
+        .field("policy", &SweepMetrics::policy)
+        .field("mean_waiting", &SweepMetrics::mean_waiting)
+        .field("p95_waiting", &SweepMetrics::p95_waiting)
+        .field("mean_turn_around", &SweepMetrics::mean_turn_around)
+        .field("p95_turn_around", &SweepMetrics::p95_turn_around)
+        .field("throughput", &SweepMetrics::throughput)
+        .field("cpu_utilisation", &SweepMetrics::cpu_utilisation);
+
+    register_vector<Process>("vector<Process>");
+    register_vector<int>("vector<int>");
+    register_vector<SweepMetrics>("vector<SweepMetrics>");
+
+    class_<BatchScheduler>("BatchScheduler")
+        .constructor<>()
+        .function("sweep", &BatchScheduler::sweep);
+}
@@ -0,0 +1,56 @@
+#include <emscripten/bind.h>
+#include "memory/translation.h"
+
+using namespace emscripten;
+
+namespace {
+
+// 64-bit counters cross to JS as plain numbers, exact up to 2^53
+template <long long TranslationResult::*Count>
+double get_count(const TranslationResult& r) {
+    return (double)(r.*Count);
+}
+
+template <long long TranslationResult::*Count>
+void set_count(TranslationResult& r, double value) {
+    r.*Count = (long long)value;
+}
+
+} // namespace
+
+EMSCRIPTEN_BINDINGS(memory_translation_module) {
+    register_vector<int>("vector<int>");
+    register_vector<double>("vector<double>");
+
+    value_object<TranslationConfig>("TranslationConfig")
+        .field("page_bits", &TranslationConfig::page_bits)
+        .field("level_bits", &TranslationConfig::level_bits)
+        .field("tlb_sets", &TranslationConfig::tlb_sets)
+        .field("tlb_ways", &TranslationConfig::tlb_ways)
+        .field("tlb_policy", &TranslationConfig::tlb_policy)
+        .field("frames", &TranslationConfig::frames)
+        .field("page_policy", &TranslationConfig::page_policy)
+        .field("tlb_hit_cycles", &TranslationConfig::tlb_hit_cycles)
+        .field("memory_cycles", &TranslationConfig::memory_cycles)
+        .field("fault_cycles", &TranslationConfig::fault_cycles);
+
+    value_object<TranslationResult>("TranslationResult")
+        .field("accesses", &get_count<&TranslationResult::accesses>, &set_count<&TranslationResult::accesses>)
+        .field("tlb_hits", &get_count<&TranslationResult::tlb_hits>, &set_count<&TranslationResult::tlb_hits>)
+        .field("tlb_misses", &get_count<&TranslationResult::tlb_misses>, &set_count<&TranslationResult::tlb_misses>)
+        .field("tlb_hit_rate", &TranslationResult::tlb_hit_rate)
+        .field("page_walks", &get_count<&TranslationResult::page_walks>, &set_count<&TranslationResult::page_walks>)
+        .field("walk_reads", &get_count<&TranslationResult::walk_reads>, &set_count<&TranslationResult::walk_reads>)
+        .field("page_faults", &get_count<&TranslationResult::page_faults>, &set_count<&TranslationResult::page_faults>)
+        .field("evictions", &get_count<&TranslationResult::evictions>, &set_count<&TranslationResult::evictions>)
+        .field("shootdowns", &get_count<&TranslationResult::shootdowns>, &set_count<&TranslationResult::shootdowns>)
+        .field("page_tables", &TranslationResult::page_tables)
+        .field("cycles", &TranslationResult::cycles)
+        .field("cycles_per_access", &TranslationResult::cycles_per_access);
+
+    function("default_translation_config", &default_translation_config);
+
+    class_<TranslationSimulator>("TranslationSimulator")
+        .constructor<>()
+        .function("simulate", &TranslationSimulator::simulate);
+}
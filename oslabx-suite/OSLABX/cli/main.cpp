@@ -0,0 +1,677 @@
+// Command-line runner for the native OSLABX engines.
+// Reads a workload from a file, runs one algorithm and prints its metrics.
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdlib>
+#include "scheduler/scheduler.h"
+#include "scheduler/batch.h"
+#include "scheduler/mlfq.h"
+#include "scheduler/multicore.h"
+#include "scheduler/streaming.h"
+#include "memory/page_replacement.h"
+#include "memory/page_trace.h"
+#include "memory/translation.h"
+#include "memory/fit_strategies.h"
+#include "memory/allocator.h"
+#include "disk/disk_scheduling.h"
+#include "disk/disk_simulator.h"
+#include "fileSystem/fs_simulator.h"
+
+static void usage() {
+    std::cerr <<
+        "usage:\n"
+        "  oslabx sched <fcfs|sjf|rr|priority|srtf|preemptive-priority> <workload> [quantum]\n"
+        "  oslabx sched mlfq <workload> [quantums] [boost_interval]\n"
+        "      workload: one process per line, id,arrival,burst[,priority]\n"
+        "      quantums: one per level, comma separated (default 2,4,8)\n"
+        "  oslabx stream <fcfs|sjf|rr|priority|srtf|preemptive-priority> <workload> [quantum] [chunk]\n"
+        "      reads the workload in chunks of `chunk` rows (default 65536), arrival ordered\n"
+        "  oslabx multicore <fcfs|sjf|rr|priority> <workload> <cores> [global|push|steal] [quantum]\n"
+        "  oslabx pages <fifo|lru|optimal|lfu|mfu|clock|arc|2q|lirs> <trace> <frames>\n"
+        "      trace: page numbers separated by commas or whitespace\n"
+        "  oslabx pack <trace> <out.bin>\n"
+        "      converts a text trace to the binary format replay reads\n"
+        "  oslabx replay <fifo|lru|optimal|lfu|mfu|clock|arc|2q|lirs> <trace.bin> <frames> [window]\n"
+        "      summary counters only, plus the fault rate of every `window` references\n"
+        "  oslabx tlb <addresses> <frames> [page_policy] [tlb_sets] [tlb_ways] [lru|fifo|random] [level_bits]\n"
+        "      addresses: virtual addresses, decimal or 0x hex, separated by commas or whitespace\n"
+        "      page_policy: as for pages (default lru); level_bits: per level, root first (default 9,9,9,9)\n"
+        "  oslabx mrc <lru|optimal> <trace> <max_frames>\n"
+        "      fault count and miss ratio for every frame count up to max_frames\n"
+        "  oslabx disk <fcfs|sstf|scan|c-scan|look|c-look|all> <requests> <head> [disk_size] [direction] [full|summary|runs]\n"
+        "      requests: cylinder numbers separated by commas or whitespace\n"
+        "      summary and runs skip the seek sequence vector; runs also counts its run-length pairs\n"
+        "  oslabx disksim <fcfs|sstf|look|c-look|n-step|fscan|deadline> <requests> <head> [batch_size]\n"
+        "      requests: one per line, arrival_ms,cylinder[,deadline_ms]; batch_size is N for n-step (default 16)\n"
+        "  oslabx fit <first|best|worst> <blocks> <requests>\n"
+        "      blocks, requests: sizes separated by commas or whitespace\n"
+        "  oslabx alloc <first|next|best|worst|buddy|slab> <events> <heap_size> [sample_interval]\n"
+        "      events: one per line, id,size to allocate or id alone to free it\n"
+        "  oslabx fs <contiguous|linked|indexed|extent> <events> <total_blocks> [sample_interval]\n"
+        "      events: one per line, create <id> <blocks>, append <id> <blocks>, truncate <id> <blocks>,\n"
+        "      delete <id> or defrag\n"
+        "Lines starting with '#' and non-numeric header lines are skipped.\n";
+}
+
+// Splits a line into integers; false for comments, blanks and header lines
+static bool parse_row(std::string& line, std::vector<int>& row) {
+    for (char& c : line) if (c == ',' || c == ';' || c == '\t') c = ' ';
+    std::istringstream ss(line);
+    row.clear();
+    std::string tok;
+    while (ss >> tok) {
+        if (tok[0] == '#') break;
+        char* end = nullptr;
+        long v = std::strtol(tok.c_str(), &end, 10);
+        if (*end != '\0') return false;
+        row.push_back((int)v);
+    }
+    return !row.empty();
+}
+
+static std::ifstream open_input(const std::string& path) {
+    std::ifstream in(path);
+    if (!in) {
+        std::cerr << "cannot open " << path << "\n";
+        std::exit(1);
+    }
+    return in;
+}
+
+// Splits every non-comment line of a file into integer rows.
+static std::vector<std::vector<int>> read_rows(const std::string& path) {
+    std::ifstream in = open_input(path);
+    std::vector<std::vector<int>> rows;
+    std::string line;
+    std::vector<int> row;
+    while (std::getline(in, line)) {
+        if (parse_row(line, row)) rows.push_back(row);
+    }
+    return rows;
+}
+
+static std::vector<int> read_values(const std::string& path) {
+    std::vector<int> values;
+    for (auto& row : read_rows(path)) values.insert(values.end(), row.begin(), row.end());
+    return values;
+}
+
+// Like read_values, but 64-bit and accepting 0x hex
+static std::vector<uint64_t> read_addresses(const std::string& path) {
+    std::ifstream in = open_input(path);
+    std::vector<uint64_t> addresses;
+    std::string line, tok;
+    while (std::getline(in, line)) {
+        for (char& c : line) if (c == ',' || c == ';' || c == '\t') c = ' ';
+        std::istringstream ss(line);
+        while (ss >> tok) {
+            if (tok[0] == '#') break;
+            char* end = nullptr;
+            uint64_t v = std::strtoull(tok.c_str(), &end, 0);
+            if (*end == '\0') addresses.push_back(v);
+        }
+    }
+    return addresses;
+}
+
+static double elapsed_ms(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+static std::vector<Process> read_workload(const std::string& path) {
+    std::vector<Process> processes;
+    for (auto& row : read_rows(path)) {
+        if (row.size() < 3) continue;
+        int priority = row.size() > 3 ? row[3] : 0;
+        processes.push_back({row[0], row[2], row[1], priority, row[2], 0, 0, 0});
+    }
+    return processes;
+}
+
+// SchedulingPolicy id for a CLI name, -1 when unknown
+static int policy_from_name(const std::string& algo) {
+    if (algo == "fcfs") return POLICY_FCFS;
+    if (algo == "sjf") return POLICY_SJF;
+    if (algo == "rr") return POLICY_ROUND_ROBIN;
+    if (algo == "priority") return POLICY_PRIORITY;
+    if (algo == "srtf") return POLICY_SRTF;
+    if (algo == "preemptive-priority") return POLICY_PREEMPTIVE_PRIORITY;
+    return -1;
+}
+
+// PagePolicy id for a CLI name, -1 when unknown
+static int page_policy_from_name(const std::string& algo) {
+    if (algo == "fifo") return PAGE_FIFO;
+    if (algo == "lru") return PAGE_LRU;
+    if (algo == "optimal") return PAGE_OPTIMAL;
+    if (algo == "lfu") return PAGE_LFU;
+    if (algo == "mfu") return PAGE_MFU;
+    if (algo == "clock") return PAGE_CLOCK;
+    if (algo == "arc") return PAGE_ARC;
+    if (algo == "2q") return PAGE_TWO_QUEUE;
+    if (algo == "lirs") return PAGE_LIRS;
+    return -1;
+}
+
+static void print_metrics(const SweepMetrics& m, size_t count) {
+    std::cout << "processes: " << count << "\n"
+              << "mean_waiting: " << m.mean_waiting << "\n"
+              << "p95_waiting: " << m.p95_waiting << "\n"
+              << "mean_turn_around: " << m.mean_turn_around << "\n"
+              << "p95_turn_around: " << m.p95_turn_around << "\n"
+              << "throughput: " << m.throughput << "\n"
+              << "cpu_utilisation: " << m.cpu_utilisation << "\n";
+}
+
+static int run_sched(int argc, char** argv) {
+    if (argc < 4) { usage(); return 2; }
+    std::string algo = argv[2];
+    int quantum = argc > 4 ? std::atoi(argv[4]) : 2;
+    std::vector<Process> processes = read_workload(argv[3]);
+
+    std::vector<int> quantums;
+    if (algo == "mlfq") {
+        std::istringstream ss(argc > 4 ? argv[4] : "2,4,8");
+        std::string q;
+        while (std::getline(ss, q, ',')) quantums.push_back(std::atoi(q.c_str()));
+    }
+
+    int policy = policy_from_name(algo); // -1 for mlfq, which has no batch policy id
+    if (policy == -1 && algo != "mlfq") { usage(); return 2; }
+
+    auto start = std::chrono::steady_clock::now();
+    std::stable_sort(processes.begin(), processes.end(), [](const Process& a, const Process& b) {
+        return a.arrival_time < b.arrival_time;
+    });
+    if (algo == "mlfq") run_mlfq(processes, quantums, argc > 5 ? std::atoi(argv[5]) : 0);
+    else run_policy(processes, policy, quantum);
+    double ms = elapsed_ms(start);
+
+    print_metrics(summarize(processes, 0, policy), processes.size());
+    std::cout << "elapsed_ms: " << ms << "\n";
+    return 0;
+}
+
+// Feeds the workload through StreamingScheduler without loading it whole;
+// only running totals are kept, so percentiles are not reported
+static int run_stream(int argc, char** argv) {
+    if (argc < 4) { usage(); return 2; }
+    int policy = policy_from_name(argv[2]);
+    if (policy == -1) { usage(); return 2; }
+    int quantum = argc > 4 ? std::atoi(argv[4]) : 2;
+    size_t chunk_size = argc > 5 ? std::max(1, std::atoi(argv[5])) : 65536;
+
+    std::ifstream in = open_input(argv[3]);
+    StreamingScheduler stream(policy, quantum);
+    long long count = 0, total_waiting = 0, total_turn_around = 0;
+    int peak_live = 0;
+    auto consume = [&](const std::vector<Process>& finished) {
+        for (auto& p : finished) {
+            count++;
+            total_waiting += p.waiting_time;
+            total_turn_around += p.turn_around_time;
+        }
+        peak_live = std::max(peak_live, stream.live());
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<Process> chunk;
+    std::string line;
+    std::vector<int> row;
+    while (std::getline(in, line)) {
+        if (!parse_row(line, row) || row.size() < 3) continue;
+        int priority = row.size() > 3 ? row[3] : 0;
+        chunk.push_back({row[0], row[2], row[1], priority, row[2], 0, 0, 0});
+        if (chunk.size() == chunk_size) {
+            consume(stream.push(std::move(chunk)));
+            chunk.clear();
+        }
+    }
+    consume(stream.push(std::move(chunk)));
+    consume(stream.finish());
+    double ms = elapsed_ms(start);
+
+    std::cout << "processes: " << count << "\n"
+              << "mean_waiting: " << (count ? (double)total_waiting / count : 0.0) << "\n"
+              << "mean_turn_around: " << (count ? (double)total_turn_around / count : 0.0) << "\n"
+              << "peak_live: " << peak_live << "\n"
+              << "elapsed_ms: " << ms << "\n";
+    return 0;
+}
+
+static int run_multicore_cmd(int argc, char** argv) {
+    if (argc < 5) { usage(); return 2; }
+    std::string algo = argv[2];
+    std::vector<Process> processes = read_workload(argv[3]);
+    int cores = std::atoi(argv[4]);
+    std::string mode = argc > 5 ? argv[5] : "global";
+    int quantum = argc > 6 ? std::atoi(argv[6]) : 2;
+
+    int policy = policy_from_name(algo);
+    if (policy == -1 || policy == POLICY_SRTF || policy == POLICY_PREEMPTIVE_PRIORITY) { usage(); return 2; }
+
+    int balancing;
+    if (mode == "global") balancing = BALANCE_GLOBAL;
+    else if (mode == "push") balancing = BALANCE_PUSH;
+    else if (mode == "steal") balancing = BALANCE_STEAL;
+    else { usage(); return 2; }
+
+    auto start = std::chrono::steady_clock::now();
+    std::stable_sort(processes.begin(), processes.end(), [](const Process& a, const Process& b) {
+        return a.arrival_time < b.arrival_time;
+    });
+    MulticoreResult r;
+    run_multicore(processes, cores, policy, balancing, quantum, r);
+    double ms = elapsed_ms(start);
+
+    print_metrics(summarize(processes, 0, policy), processes.size());
+    std::cout << "makespan: " << r.makespan << "\n"
+              << "migrations: " << r.migrations << "\n"
+              << "balance_moves: " << r.balance_moves << "\n"
+              << "imbalance: " << r.imbalance << "\n";
+    for (auto& c : r.cores) {
+        std::cout << "core " << c.core << ": busy " << c.busy_time << ", utilisation " << c.utilisation
+                  << ", dispatches " << c.dispatches << ", stolen " << c.stolen << "\n";
+    }
+    std::cout << "elapsed_ms: " << ms << "\n";
+    return 0;
+}
+
+static int run_pages(int argc, char** argv) {
+    if (argc < 5) { usage(); return 2; }
+    std::string algo = argv[2];
+    std::vector<int> pages = read_values(argv[3]);
+    int frames = std::atoi(argv[4]);
+
+    int policy = page_policy_from_name(algo);
+    if (policy < 0) { usage(); return 2; }
+
+    auto start = std::chrono::steady_clock::now();
+    // Counted straight off the engine; PageStep snapshots would cost O(frames) per step
+    long long faults = 0;
+    with_engine(policy, pages, frames, [&](auto& engine) { faults = count_faults(pages, engine); });
+    double ms = elapsed_ms(start);
+
+    std::cout << "references: " << pages.size() << "\n"
+              << "faults: " << faults << "\n"
+              << "hits: " << (long long)pages.size() - faults << "\n"
+              << "fault_rate: " << (pages.empty() ? 0.0 : (double)faults / pages.size()) << "\n"
+              << "elapsed_ms: " << ms << "\n";
+    return 0;
+}
+
+// Text to binary trace, a line at a time
+static int run_pack(int argc, char** argv) {
+    if (argc < 4) { usage(); return 2; }
+    std::ifstream in = open_input(argv[2]);
+    PageTraceWriter out;
+    if (!out.open(argv[3])) {
+        std::cerr << "cannot write " << argv[3] << "\n";
+        return 1;
+    }
+    std::string line;
+    std::vector<int> row;
+    long long count = 0;
+    while (std::getline(in, line)) {
+        if (!parse_row(line, row)) continue;
+        out.write(row.data(), row.size());
+        count += row.size();
+    }
+    if (!out.close()) {
+        std::cerr << "cannot write " << argv[3] << "\n";
+        return 1;
+    }
+    std::cout << "references: " << count << "\n";
+    return 0;
+}
+
+static int run_replay(int argc, char** argv) {
+    if (argc < 5) { usage(); return 2; }
+    int policy = page_policy_from_name(argv[2]);
+    if (policy < 0) { usage(); return 2; }
+    PageTrace trace;
+    if (!trace.open(argv[3])) {
+        std::cerr << "cannot read trace " << argv[3] << "\n";
+        return 1;
+    }
+    int frames = std::atoi(argv[4]);
+    int window = argc > 5 ? std::atoi(argv[5]) : 0;
+
+    auto start = std::chrono::steady_clock::now();
+    PageTraceSummary s = replay_page_trace(trace, policy, frames, window);
+    double ms = elapsed_ms(start);
+
+    std::cout << "references: " << s.references << "\n"
+              << "faults: " << s.faults << "\n"
+              << "hits: " << s.hits << "\n"
+              << "evictions: " << s.evictions << "\n"
+              << "fault_rate: " << (s.references ? (double)s.faults / s.references : 0.0) << "\n";
+    if (!s.window_fault_rate.empty()) {
+        std::cout << "window_start,fault_rate\n";
+        for (size_t w = 0; w < s.window_fault_rate.size(); ++w) {
+            std::cout << (long long)w * s.window << "," << s.window_fault_rate[w] << "\n";
+        }
+    }
+    std::cout << "elapsed_ms: " << ms << "\n";
+    return 0;
+}
+
+static int run_tlb(int argc, char** argv) {
+    if (argc < 4) { usage(); return 2; }
+    std::vector<uint64_t> addresses = read_addresses(argv[2]);
+    TranslationConfig config = default_translation_config();
+    config.frames = std::atoi(argv[3]);
+    if (argc > 4) config.page_policy = page_policy_from_name(argv[4]);
+    if (argc > 5) config.tlb_sets = std::atoi(argv[5]);
+    if (argc > 6) config.tlb_ways = std::atoi(argv[6]);
+    if (argc > 7) {
+        std::string tlb = argv[7];
+        if (tlb == "lru") config.tlb_policy = TLB_LRU;
+        else if (tlb == "fifo") config.tlb_policy = TLB_FIFO;
+        else if (tlb == "random") config.tlb_policy = TLB_RANDOM;
+        else { usage(); return 2; }
+    }
+    if (argc > 8) {
+        std::string bits = argv[8];
+        std::vector<int> row;
+        if (!parse_row(bits, row)) { usage(); return 2; }
+        config.level_bits = row;
+    }
+    if (config.page_policy < 0) { usage(); return 2; }
+
+    auto start = std::chrono::steady_clock::now();
+    TranslationResult r = simulate_translation(addresses.data(), addresses.size(), config);
+    double ms = elapsed_ms(start);
+
+    std::cout << "accesses: " << r.accesses << "\n"
+              << "tlb_hits: " << r.tlb_hits << "\n"
+              << "tlb_misses: " << r.tlb_misses << "\n"
+              << "tlb_hit_rate: " << r.tlb_hit_rate << "\n"
+              << "page_walks: " << r.page_walks << "\n"
+              << "walk_reads: " << r.walk_reads << "\n"
+              << "page_faults: " << r.page_faults << "\n"
+              << "evictions: " << r.evictions << "\n"
+              << "shootdowns: " << r.shootdowns << "\n"
+              << "page_tables: " << r.page_tables << "\n"
+              << "cycles: " << r.cycles << "\n"
+              << "cycles_per_access: " << r.cycles_per_access << "\n"
+              << "elapsed_ms: " << ms << "\n";
+    return 0;
+}
+
+static int run_mrc(int argc, char** argv) {
+    if (argc < 5) { usage(); return 2; }
+    std::string algo = argv[2];
+    std::vector<int> pages = read_values(argv[3]);
+    int max_frames = std::atoi(argv[4]);
+
+    auto start = std::chrono::steady_clock::now();
+    MissRatioCurve curve;
+    if (algo == "lru") curve = lru_miss_ratio_curve(pages, max_frames);
+    else if (algo == "optimal") curve = opt_miss_ratio_curve(pages, max_frames);
+    else { usage(); return 2; }
+    double ms = elapsed_ms(start);
+
+    std::cout << "references: " << curve.references << "\n"
+              << "distinct_pages: " << curve.distinct_pages << "\n"
+              << "frames,faults,miss_ratio\n";
+    for (int c = 1; c <= (int)curve.faults.size(); ++c) {
+        std::cout << c << "," << curve.faults[c - 1] << "," << curve.miss_ratio[c - 1] << "\n";
+    }
+    std::cout << "elapsed_ms: " << ms << "\n";
+    return 0;
+}
+
+static int run_disk(int argc, char** argv) {
+    if (argc < 5) { usage(); return 2; }
+    std::string algo = argv[2];
+    std::vector<int> requests = read_values(argv[3]);
+    int head = std::atoi(argv[4]);
+    int disk_size = argc > 5 ? std::atoi(argv[5]) : 200;
+    int direction = argc > 6 ? std::atoi(argv[6]) : 1;
+
+    DiskScheduler ds;
+    auto start = std::chrono::steady_clock::now();
+    if (algo == "all") {
+        DiskComparison c = ds.compare_all(requests, head, disk_size);
+        double ms = elapsed_ms(start);
+        std::cout << "requests: " << requests.size() << "\n"
+                  << "fcfs: " << (long long)c.fcfs << "\n"
+                  << "sstf: " << (long long)c.sstf << "\n"
+                  << "scan: " << (long long)c.scan << "\n"
+                  << "c-scan: " << (long long)c.c_scan << "\n"
+                  << "look: " << (long long)c.look << "\n"
+                  << "c-look: " << (long long)c.c_look << "\n"
+                  << "elapsed_ms: " << ms << "\n";
+        return 0;
+    }
+    int algorithm;
+    if (algo == "fcfs") algorithm = DISK_FCFS;
+    else if (algo == "sstf") algorithm = DISK_SSTF;
+    else if (algo == "scan") algorithm = DISK_SCAN;
+    else if (algo == "c-scan") algorithm = DISK_C_SCAN;
+    else if (algo == "look") algorithm = DISK_LOOK;
+    else if (algo == "c-look") algorithm = DISK_C_LOOK;
+    else { usage(); return 2; }
+    std::string output = argc > 7 ? argv[7] : "full";
+
+    if (output == "summary" || output == "runs") {
+        SeekTrace t = ds.trace(requests, algorithm, head, disk_size, direction,
+                               output == "runs" ? DISK_OUTPUT_RUNS : DISK_OUTPUT_SUMMARY);
+        double ms = elapsed_ms(start);
+        SeekSummary sum = t.summary();
+        std::cout << "requests: " << requests.size() << "\n"
+                  << "total_seek_count: " << (long long)sum.total_seek << "\n"
+                  << "moves: " << sum.moves << "\n"
+                  << "max_seek: " << sum.max_seek << "\n"
+                  << "mean_seek: " << sum.mean_seek << "\n"
+                  << "reversals: " << sum.reversals << "\n";
+        if (output == "runs") std::cout << "runs: " << t.run_count() << "\n";
+        std::cout << "elapsed_ms: " << ms << "\n";
+        return 0;
+    }
+    if (output != "full") { usage(); return 2; }
+
+    DiskResult r;
+    if (algorithm == DISK_FCFS) r = ds.fcfs(requests, head);
+    else if (algorithm == DISK_SSTF) r = ds.sstf(requests, head);
+    else if (algorithm == DISK_SCAN) r = ds.scan(requests, head, disk_size, direction);
+    else if (algorithm == DISK_C_SCAN) r = ds.c_scan(requests, head, disk_size);
+    else if (algorithm == DISK_LOOK) r = ds.look(requests, head, direction);
+    else r = ds.c_look(requests, head);
+    double ms = elapsed_ms(start);
+
+    std::cout << "requests: " << requests.size() << "\n"
+              << "total_seek_count: " << r.total_seek_count << "\n"
+              << "elapsed_ms: " << ms << "\n";
+    return 0;
+}
+
+static int run_disksim(int argc, char** argv) {
+    if (argc < 5) { usage(); return 2; }
+    std::string algo = argv[2];
+    int policy;
+    if (algo == "fcfs") policy = DISK_SIM_FCFS;
+    else if (algo == "sstf") policy = DISK_SIM_SSTF;
+    else if (algo == "look") policy = DISK_SIM_LOOK;
+    else if (algo == "c-look") policy = DISK_SIM_C_LOOK;
+    else if (algo == "n-step") policy = DISK_SIM_N_STEP_SCAN;
+    else if (algo == "fscan") policy = DISK_SIM_FSCAN;
+    else if (algo == "deadline") policy = DISK_SIM_DEADLINE;
+    else { usage(); return 2; }
+
+    std::vector<DiskRequest> requests;
+    for (auto& row : read_rows(argv[3])) {
+        if (row.size() < 2) continue;
+        requests.push_back({(int)requests.size(), (double)row[0], row[1], row.size() > 2 ? (double)row[2] : 0});
+    }
+    int head = std::atoi(argv[4]);
+    int batch_size = argc > 5 ? std::atoi(argv[5]) : 16;
+
+    auto start = std::chrono::steady_clock::now();
+    DiskSimResult r = simulate_disk(requests, policy, default_disk_model(), head, batch_size);
+    double ms = elapsed_ms(start);
+
+    std::cout << "requests: " << requests.size() << "\n"
+              << "mean_latency_ms: " << r.mean_latency << "\n"
+              << "p50_latency_ms: " << r.p50_latency << "\n"
+              << "p95_latency_ms: " << r.p95_latency << "\n"
+              << "p99_latency_ms: " << r.p99_latency << "\n"
+              << "max_latency_ms: " << r.max_latency << "\n"
+              << "throughput: " << r.throughput << "\n"
+              << "utilisation: " << r.utilisation << "\n"
+              << "mean_seek_distance: " << r.mean_seek_distance << "\n"
+              << "missed_deadlines: " << r.missed_deadlines << "\n"
+              << "elapsed_ms: " << ms << "\n";
+    return 0;
+}
+
+static int run_fit(int argc, char** argv) {
+    if (argc < 5) { usage(); return 2; }
+    std::string algo = argv[2];
+    std::vector<MemoryBlock> blocks;
+    for (int size : read_values(argv[3])) blocks.push_back({(int)blocks.size(), size, false, -1});
+    std::vector<ProcessRequest> requests;
+    for (int size : read_values(argv[4])) requests.push_back({(int)requests.size(), size, false, -1});
+
+    MemoryManager mm;
+    auto start = std::chrono::steady_clock::now();
+    AllocationResult r;
+    if (algo == "first") r = mm.first_fit(blocks, requests);
+    else if (algo == "best") r = mm.best_fit(blocks, requests);
+    else if (algo == "worst") r = mm.worst_fit(blocks, requests);
+    else { usage(); return 2; }
+    double ms = elapsed_ms(start);
+
+    long long allocated = 0, wasted = 0;
+    for (auto& p : r.processes) {
+        if (!p.allocated) continue;
+        allocated++;
+        wasted += r.blocks[p.block_id].size - p.size;
+    }
+    std::cout << "blocks: " << blocks.size() << "\n"
+              << "requests: " << requests.size() << "\n"
+              << "allocated: " << allocated << "\n"
+              << "internal_fragmentation: " << wasted << "\n"
+              << "elapsed_ms: " << ms << "\n";
+    return 0;
+}
+
+static int run_alloc(int argc, char** argv) {
+    if (argc < 5) { usage(); return 2; }
+    std::string algo = argv[2];
+    int policy;
+    if (algo == "first") policy = ALLOC_FIRST_FIT;
+    else if (algo == "next") policy = ALLOC_NEXT_FIT;
+    else if (algo == "best") policy = ALLOC_BEST_FIT;
+    else if (algo == "worst") policy = ALLOC_WORST_FIT;
+    else if (algo == "buddy") policy = ALLOC_BUDDY;
+    else if (algo == "slab") policy = ALLOC_SLAB;
+    else { usage(); return 2; }
+
+    std::vector<AllocEvent> events;
+    for (auto& row : read_rows(argv[3])) {
+        if (row.size() > 1) events.push_back({EVENT_ALLOC, row[0], row[1]});
+        else events.push_back({EVENT_FREE, row[0], 0});
+    }
+    int heap_size = std::atoi(argv[4]);
+    int interval = argc > 5 ? std::atoi(argv[5]) : 0;
+
+    auto start = std::chrono::steady_clock::now();
+    AllocatorResult r = simulate_allocator(events, policy, heap_size, interval);
+    double ms = elapsed_ms(start);
+
+    std::cout << "events: " << events.size() << "\n"
+              << "allocations: " << r.allocations << "\n"
+              << "frees: " << r.frees << "\n"
+              << "failures: " << r.failures << "\n"
+              << "peak_requested: " << r.peak_requested << "\n"
+              << "peak_reserved: " << r.peak_reserved << "\n"
+              << "mean_search_length: " << r.mean_search_length << "\n"
+              << "max_search_length: " << r.max_search_length << "\n"
+              << "event,requested,reserved,free_blocks,largest_free,external_frag,internal_frag,mean_search,failures\n";
+    for (auto& s : r.samples) {
+        std::cout << s.event << "," << s.requested << "," << s.reserved << "," << s.free_blocks << ","
+                  << s.largest_free << "," << s.external_fragmentation << "," << s.internal_fragmentation << ","
+                  << s.mean_search_length << "," << s.failures << "\n";
+    }
+    std::cout << "events_per_second: " << (ms > 0 ? events.size() / (ms / 1000) : 0.0) << "\n"
+              << "elapsed_ms: " << ms << "\n";
+    return 0;
+}
+
+static int run_fs(int argc, char** argv) {
+    if (argc < 5) { usage(); return 2; }
+    std::string algo = argv[2];
+    int layout;
+    if (algo == "contiguous") layout = FS_CONTIGUOUS;
+    else if (algo == "linked") layout = FS_LINKED;
+    else if (algo == "indexed") layout = FS_INDEXED;
+    else if (algo == "extent") layout = FS_EXTENT;
+    else { usage(); return 2; }
+
+    std::ifstream in = open_input(argv[3]);
+    std::vector<FsEvent> events;
+    std::string line, op;
+    while (std::getline(in, line)) {
+        for (char& c : line) if (c == ',' || c == ';' || c == '\t') c = ' ';
+        std::istringstream ss(line);
+        FsEvent e = {0, 0, 0};
+        if (!(ss >> op) || op[0] == '#') continue;
+        if (op == "create") e.type = FS_CREATE;
+        else if (op == "append") e.type = FS_APPEND;
+        else if (op == "truncate") e.type = FS_TRUNCATE;
+        else if (op == "delete") e.type = FS_DELETE;
+        else if (op == "defrag") e.type = FS_DEFRAG;
+        else continue;
+        ss >> e.file >> e.blocks;
+        events.push_back(e);
+    }
+    int total_blocks = std::atoi(argv[4]);
+    int interval = argc > 5 ? std::atoi(argv[5]) : 0;
+
+    auto start = std::chrono::steady_clock::now();
+    FsResult r = simulate_file_system(events, layout, total_blocks, interval);
+    double ms = elapsed_ms(start);
+
+    std::cout << "events: " << events.size() << "\n"
+              << "creates: " << r.creates << "\n"
+              << "deletes: " << r.deletes << "\n"
+              << "failures: " << r.failures << "\n"
+              << "relocated_blocks: " << r.relocated_blocks << "\n"
+              << "defrag_passes: " << r.defrag_passes << "\n"
+              << "defrag_moved_blocks: " << r.defrag_moved_blocks << "\n"
+              << "event,files,used_blocks,free_blocks,largest_free_run,external_frag,mean_extents,fragmented_files,failures\n";
+    for (auto& s : r.samples) {
+        std::cout << s.event << "," << s.files << "," << s.used_blocks << "," << s.free_blocks << ","
+                  << s.largest_free_run << "," << s.external_fragmentation << "," << s.mean_extents << ","
+                  << s.fragmented_files << "," << s.failures << "\n";
+    }
+    std::cout << "elapsed_ms: " << ms << "\n";
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) { usage(); return 2; }
+    std::string cmd = argv[1];
+    if (cmd == "sched") return run_sched(argc, argv);
+    if (cmd == "stream") return run_stream(argc, argv);
+    if (cmd == "multicore") return run_multicore_cmd(argc, argv);
+    if (cmd == "pages") return run_pages(argc, argv);
+    if (cmd == "pack") return run_pack(argc, argv);
+    if (cmd == "replay") return run_replay(argc, argv);
+    if (cmd == "tlb") return run_tlb(argc, argv);
+    if (cmd == "mrc") return run_mrc(argc, argv);
+    if (cmd == "disk") return run_disk(argc, argv);
+    if (cmd == "disksim") return run_disksim(argc, argv);
+    if (cmd == "fit") return run_fit(argc, argv);
+    if (cmd == "alloc") return run_alloc(argc, argv);
+    if (cmd == "fs") return run_fs(argc, argv);
+    usage();
+    return 2;
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+
+struct BankerResult {
+    bool is_safe;
+    std::vector<int> safe_sequence;
+};
+
+class Banker {
+public:
+    // Simplify parameters: Flatt arrays for matricies because nested vector binding is annoying
+    // max: n*m, allocation: n*m, available: m
+    BankerResult solve(int n, int m, std::vector<int> allocation, std::vector<int> max, std::vector<int> available);
+};
@@ -1,174 +1,286 @@
-#include <iostream>
-#include <vector>
-#include <cmath>
-#include <algorithm>
-#include <emscripten/bind.h>
-
-struct DiskResult {
-    std::vector<int> seek_sequence;
-    int total_seek_count;
-};
+#include <functional>
+#include "disk_scheduling.h"
 
-class DiskScheduler {
-public:
-    DiskResult fcfs(std::vector<int> requests, int head) {
-        DiskResult result;
-        result.total_seek_count = 0;
-        result.seek_sequence.push_back(head);
-        
-        for(int req : requests) {
-            result.total_seek_count += std::abs(req - head);
-            head = req;
-            result.seek_sequence.push_back(head);
-        }
-        return result;
-    }
+namespace {
 
-    DiskResult sstf(std::vector<int> requests, int head) {
-        DiskResult result;
-        result.total_seek_count = 0;
-        result.seek_sequence.push_back(head);
-        
-        std::vector<bool> visited(requests.size(), false);
-        int count = 0;
-        
-        while(count < requests.size()) {
-            int min_dist = 1e9;
-            int idx = -1;
-            
-            for(int i=0; i<requests.size(); ++i) {
-                if(!visited[i]) {
-                    int dist = std::abs(requests[i] - head);
-                    if(dist < min_dist) {
-                        min_dist = dist;
-                        idx = i;
-                    }
-                }
+// Head movement; the seek sequence is only kept when there is somewhere to
+// put it, and the summary counters only when asked for
+struct Sweep {
+    int head;
+    long long total = 0;
+    std::vector<int>* sequence = nullptr;
+    bool summarise = false;
+    std::vector<int>* runs = nullptr; // (delta, repeat) pairs
+    int moves = 0;
+    int max_seek = 0;
+    int reversals = 0;
+    int direction = 0; // Sign of the last non-zero movement
+
+    void visit(int cylinder) { move(cylinder, std::abs(cylinder - head)); }
+
+    // Moves to `cylinder` for `cost` cylinders of seek
+    void move(int cylinder, int cost) {
+        total += cost;
+        if (summarise) {
+            moves++;
+            max_seek = std::max(max_seek, cost);
+            int step = (cylinder > head) - (cylinder < head);
+            if (step != 0) {
+                if (direction != 0 && step != direction) reversals++;
+                direction = step;
             }
-            
-            if(idx != -1) {
-                visited[idx] = true;
-                result.total_seek_count += min_dist;
-                head = requests[idx];
-                result.seek_sequence.push_back(head);
-                count++;
+            if (runs) {
+                int delta = cylinder - head;
+                if (!runs->empty() && (*runs)[runs->size() - 2] == delta) runs->back()++;
+                else {
+                    runs->push_back(delta);
+                    runs->push_back(1);
+                }
             }
         }
-        return result;
+        head = cylinder;
+        if (sequence) sequence->push_back(cylinder);
     }
+};
 
-    DiskResult scan(std::vector<int> requests, int head, int disk_size, int direction) { // direction: 1 for high, 0 for low
-        DiskResult result;
-        result.total_seek_count = 0;
-        result.seek_sequence.push_back(head);
+// Requests sorted by (cylinder, arrival index), shared by every algorithm.
+// Below `split` they lie under the starting head, from it on at or above.
+struct SortedRequests {
+    std::vector<int> cylinder;
+    std::vector<int> index;
+    int split;
 
-        std::vector<int> left, right;
-        if (direction == 0) left.push_back(0); // If scanning left, we might hit 0
-        if (direction == 1) right.push_back(disk_size - 1); // Scanning right might hit end
+    SortedRequests(const std::vector<int>& requests, int head) : SortedRequests(requests.data(), requests.size(), head) {}
 
-        for(int req : requests) {
-            if (req < head) left.push_back(req);
-            else right.push_back(req);
+    SortedRequests(const int* requests, int n, int head) {
+        std::vector<std::pair<int, int>> order(n);
+        for (int i = 0; i < n; ++i) order[i] = {requests[i], i};
+        std::sort(order.begin(), order.end());
+        for (auto& [c, i] : order) {
+            cylinder.push_back(c);
+            index.push_back(i);
         }
-        
-        std::sort(left.begin(), left.end());
-        std::sort(right.begin(), right.end());
-
-        int run = 2;
-        while(run--) {
-            if (direction == 1) { // Moving Right
-                for(int i=0; i<right.size(); ++i) {
-                    result.total_seek_count += std::abs(right[i] - head);
-                    head = right[i];
-                    result.seek_sequence.push_back(head);
-                }
-                direction = 0;
-            } else { // Moving Left
-                for(int i=left.size()-1; i>=0; --i) {
-                    result.total_seek_count += std::abs(left[i] - head);
-                    head = left[i];
-                    result.seek_sequence.push_back(head);
-                }
-                direction = 1;
-            }
+        split = std::lower_bound(cylinder.begin(), cylinder.end(), head) - cylinder.begin();
+    }
+
+    int size() const { return cylinder.size(); }
+};
+
+// Requests from `split` upwards, with an optional edge stop merged in at its
+// place in cylinder order
+void sweep_up(const SortedRequests& r, Sweep& s, bool with_edge, int edge) {
+    for (int i = r.split; i < r.size(); ++i) {
+        if (with_edge && edge < r.cylinder[i]) {
+            s.visit(edge);
+            with_edge = false;
         }
-        return result;
+        s.visit(r.cylinder[i]);
     }
-    
-    DiskResult c_scan(std::vector<int> requests, int head, int disk_size) {
-        // Assume moving right usually (or can be param). Conventionally right.
-        DiskResult result;
-        result.total_seek_count = 0;
-        result.seek_sequence.push_back(head);
-        
-        std::vector<int> left, right;
-        left.push_back(0);
-        right.push_back(disk_size - 1);
-        
-        for(int req : requests) {
-            if (req < head) left.push_back(req);
-            else right.push_back(req);
+    if (with_edge) s.visit(edge);
+}
+
+// Requests below `split`, downwards
+void sweep_down(const SortedRequests& r, Sweep& s, bool with_edge, int edge) {
+    for (int i = r.split - 1; i >= 0; --i) {
+        if (with_edge && edge > r.cylinder[i]) {
+            s.visit(edge);
+            with_edge = false;
         }
-        
-        std::sort(left.begin(), left.end());
-        std::sort(right.begin(), right.end());
-        
-        // Head -> End
-        for(int i=0; i<right.size(); ++i) {
-             result.total_seek_count += std::abs(right[i] - head);
-             head = right[i];
-             result.seek_sequence.push_back(head);
+        s.visit(r.cylinder[i]);
+    }
+    if (with_edge) s.visit(edge);
+}
+
+// Requests below `split`, upwards from the lowest
+void sweep_wrapped(const SortedRequests& r, Sweep& s, bool with_edge, int edge) {
+    for (int i = 0; i < r.split; ++i) {
+        if (with_edge && edge < r.cylinder[i]) {
+            s.visit(edge);
+            with_edge = false;
         }
-        
-        // Jump to 0
-        head = 0;
-        result.total_seek_count += 0; // The jump is not counted in seek time usually, or is max. 
-        // Standard definition: the jump is instantaneous or ignored, OR counted as cylinders. 
-        // But usually C-SCAN implies circular list, so we jump to start. 
-        // Some definitions count the jump (Total cylinders traversed). 
-        // Let's count the jump distance for completeness if physical, or not if treating as circular logic.
-        // Actually, normally traverse distance is calculated. 
-        // "The head is moved to the other end of the disk."
-        // We will assume simpler: just serve requests.
-        // If we are strictly implementing the SEEK COUNT, we usually count the jump.
-        // However, I will define seek count as pure head movement service.
-        // Let's count it to be safe (max - min).
-        
-        result.total_seek_count += (disk_size - 1); // Jump from end to 0
-        result.seek_sequence.push_back(0);
-        
-        for(int i=0; i<left.size(); ++i) {
-             result.total_seek_count += std::abs(left[i] - head);
-             head = left[i];
-             result.seek_sequence.push_back(head);
+        s.visit(r.cylinder[i]);
+    }
+    if (with_edge) s.visit(edge);
+}
+
+// The unvisited requests are always a prefix and a suffix of the sorted
+// order, so the nearest one is at one of the two ends. An equal distance
+// either way goes to the request that came first, as in a linear scan.
+void run_sstf(const SortedRequests& r, Sweep& s) {
+    int n = r.size();
+    // First sorted position of each cylinder's run of duplicates
+    std::vector<int> run_start(n);
+    for (int i = 0; i < n; ++i) run_start[i] = i > 0 && r.cylinder[i] == r.cylinder[i - 1] ? run_start[i - 1] : i;
+
+    int lo = r.split - 1, hi = r.split;
+    while (lo >= 0 || hi < n) {
+        bool down;
+        if (hi == n) down = true;
+        else if (lo < 0) down = false;
+        else {
+            int below = s.head - r.cylinder[lo], above = r.cylinder[hi] - s.head;
+            down = below < above || (below == above && r.index[run_start[lo]] < r.index[hi]);
         }
-        
-        // Clean up: The 0 and disk_size-1 might not be requests, only added for boundary.
-        // But in result sequence we usually show them.
-        // Wait, if 0 and disk-1 are not requests, they shouldn't necessarily be in seek sequence unless hit.
-        // In SCAN/C-SCAN we DO hit the boundaries.
-        // But we shouldn't duplicate them if requested.
-        // I will leave logic as is, if 0 is in 'requests', it appears twice?
-        // Let's filter 'requests' to avoid duplicates with boundary.
-        // Or clearer: Just append boundary to list before sorting.
-        
-        return result;
+        if (down) s.visit(r.cylinder[lo--]);
+        else s.visit(r.cylinder[hi++]);
     }
-};
+}
+
+void run_scan(const SortedRequests& r, Sweep& s, int disk_size, int direction) {
+    if (direction == 1) {
+        sweep_up(r, s, true, disk_size - 1);
+        sweep_down(r, s, false, 0);
+    } else {
+        // Any direction other than 1 starts downwards; only 0 also touches the edge
+        sweep_down(r, s, direction == 0, 0);
+        sweep_up(r, s, false, 0);
+    }
+}
+
+void run_c_scan(const SortedRequests& r, Sweep& s, int disk_size) {
+    sweep_up(r, s, true, disk_size - 1);
+    // The return to cylinder 0 counts as a full-width seek
+    s.move(0, disk_size - 1);
+    sweep_wrapped(r, s, true, 0);
+}
+
+void run_look(const SortedRequests& r, Sweep& s, int direction) {
+    if (direction == 1) {
+        sweep_up(r, s, false, 0);
+        sweep_down(r, s, false, 0);
+    } else {
+        sweep_down(r, s, false, 0);
+        sweep_up(r, s, false, 0);
+    }
+}
+
+// The jump back to the lowest request counts as head movement
+void run_c_look(const SortedRequests& r, Sweep& s) {
+    sweep_up(r, s, false, 0);
+    sweep_wrapped(r, s, false, 0);
+}
+
+DiskResult with_sequence(int head, const std::function<void(Sweep&)>& run) {
+    DiskResult result;
+    result.seek_sequence.push_back(head);
+    Sweep s{head};
+    s.sequence = &result.seek_sequence;
+    run(s);
+    result.total_seek_count = s.total;
+    return result;
+}
+
+// Dispatch by DiskAlgorithm id; FCFS needs no sorted order
+void run_algorithm(int algorithm, const int* requests, int n, Sweep& s, int disk_size, int direction) {
+    if (algorithm == DISK_FCFS) {
+        for (int i = 0; i < n; ++i) s.visit(requests[i]);
+        return;
+    }
+    SortedRequests r(requests, n, s.head);
+    switch (algorithm) {
+        case DISK_SSTF: run_sstf(r, s); break;
+        case DISK_SCAN: run_scan(r, s, disk_size, direction); break;
+        case DISK_C_SCAN: run_c_scan(r, s, disk_size); break;
+        case DISK_LOOK: run_look(r, s, direction); break;
+        case DISK_C_LOOK: run_c_look(r, s); break;
+    }
+}
 
-using namespace emscripten;
+} // namespace
 
-EMSCRIPTEN_BINDINGS(disk_module) {
-    value_object<DiskResult>("DiskResult")
-        .field("seek_sequence", &DiskResult::seek_sequence)
-        .field("total_seek_count", &DiskResult::total_seek_count);
+std::vector<int> SeekTrace::decode() const {
+    std::vector<int> sequence{first};
+    int head = first;
+    for (size_t k = 0; k < runs.size(); k += 2) {
+        for (int i = 0; i < runs[k + 1]; ++i) {
+            head += runs[k];
+            sequence.push_back(head);
+        }
+    }
+    return sequence;
+}
 
-    register_vector<int>("vector<int>");
+DiskResult DiskScheduler::fcfs(std::vector<int> requests, int head) {
+    DiskResult result;
+    result.total_seek_count = 0;
+    result.seek_sequence.push_back(head);
     
-    class_<DiskScheduler>("DiskScheduler")
-        .constructor<>()
-        .function("fcfs", &DiskScheduler::fcfs)
-        .function("sstf", &DiskScheduler::sstf)
-        .function("scan", &DiskScheduler::scan)
-        .function("c_scan", &DiskScheduler::c_scan);
+    for(int req : requests) {
+        result.total_seek_count += std::abs(req - head);
+        head = req;
+        result.seek_sequence.push_back(head);
+    }
+    return result;
+}
+
+DiskResult DiskScheduler::sstf(std::vector<int> requests, int head) {
+    SortedRequests r(requests, head);
+    return with_sequence(head, [&](Sweep& s) { run_sstf(r, s); });
+}
+
+DiskResult DiskScheduler::scan(std::vector<int> requests, int head, int disk_size, int direction) {
+    SortedRequests r(requests, head);
+    return with_sequence(head, [&](Sweep& s) { run_scan(r, s, disk_size, direction); });
+}
+
+DiskResult DiskScheduler::c_scan(std::vector<int> requests, int head, int disk_size) {
+    SortedRequests r(requests, head);
+    return with_sequence(head, [&](Sweep& s) { run_c_scan(r, s, disk_size); });
+}
+
+DiskResult DiskScheduler::look(std::vector<int> requests, int head, int direction) {
+    SortedRequests r(requests, head);
+    return with_sequence(head, [&](Sweep& s) { run_look(r, s, direction); });
+}
+
+DiskResult DiskScheduler::c_look(std::vector<int> requests, int head) {
+    SortedRequests r(requests, head);
+    return with_sequence(head, [&](Sweep& s) { run_c_look(r, s); });
+}
+
+DiskComparison DiskScheduler::compare_all(std::vector<int> requests, int head, int disk_size) {
+    SortedRequests r(requests, head);
+    DiskComparison c;
+    Sweep fcfs{head};
+    for (int req : requests) fcfs.visit(req);
+    c.fcfs = fcfs.total;
+
+    Sweep s{head};
+    run_sstf(r, s);
+    c.sstf = s.total;
+    s = Sweep{head};
+    run_scan(r, s, disk_size, 1);
+    c.scan = s.total;
+    s = Sweep{head};
+    run_c_scan(r, s, disk_size);
+    c.c_scan = s.total;
+    s = Sweep{head};
+    run_look(r, s, 1);
+    c.look = s.total;
+    s = Sweep{head};
+    run_c_look(r, s);
+    c.c_look = s.total;
+    return c;
+}
+
+SeekTrace DiskScheduler::trace(std::vector<int> requests, int algorithm, int head, int disk_size, int direction,
+                               int output) {
+    return trace_array((uintptr_t)requests.data(), requests.size(), algorithm, head, disk_size, direction, output);
+}
+
+SeekTrace DiskScheduler::trace_array(uintptr_t requests, int n, int algorithm, int head, int disk_size,
+                                     int direction, int output) {
+    SeekTrace t;
+    t.first = head;
+    if (algorithm < DISK_FCFS || algorithm > DISK_C_LOOK || (output != DISK_OUTPUT_SUMMARY && output != DISK_OUTPUT_RUNS)) {
+        t.stats.moves = -1;
+        return t;
+    }
+    Sweep s{head};
+    s.summarise = true;
+    if (output == DISK_OUTPUT_RUNS) s.runs = &t.runs;
+    run_algorithm(algorithm, (const int*)requests, n, s, disk_size, direction);
+    t.runs.shrink_to_fit();
+    t.stats = {(double)s.total, s.moves, s.max_seek, s.moves > 0 ? (double)s.total / s.moves : 0, s.reversals};
+    return t;
 }
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <iostream>
+#include <cstdint>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+struct DiskResult {
+    std::vector<int> seek_sequence;
+    int total_seek_count;
+};
+
+// Total seek count of every algorithm over the same requests, as doubles
+// since they outgrow an int on million-request workloads
+struct DiskComparison {
+    double fcfs;
+    double sstf;
+    double scan;
+    double c_scan;
+    double look;
+    double c_look;
+};
+
+// Algorithm ids for DiskScheduler::trace
+enum DiskAlgorithm {
+    DISK_FCFS = 0,
+    DISK_SSTF = 1,
+    DISK_SCAN = 2,
+    DISK_C_SCAN = 3,
+    DISK_LOOK = 4,
+    DISK_C_LOOK = 5
+};
+
+enum DiskOutput {
+    DISK_OUTPUT_SUMMARY = 0, // Counters only
+    DISK_OUTPUT_RUNS = 1     // Counters plus the run-length encoded sequence
+};
+
+struct SeekSummary {
+    double total_seek; // Outgrows an int on million-request workloads
+    int moves;         // Head movements, edge stops and C-SCAN's return included
+    int max_seek;
+    double mean_seek;
+    int reversals;     // Direction changes between non-zero movements
+};
+
+// Seek sequence without the per-cylinder vector: from start(), the head
+// moves by runs[2k] cylinders runs[2k + 1] times in a row. Repeated
+// cylinders and evenly spaced requests collapse into a single pair.
+class SeekTrace {
+public:
+    int start() const { return first; }
+    SeekSummary summary() const { return stats; }
+    int run_count() const { return runs.size() / 2; }
+    // Byte offset of the 2 * run_count() int32 values, for an Int32Array
+    // view into linear memory; valid until the trace is deleted
+    uintptr_t runs_data() const { return (uintptr_t)runs.data(); }
+    // Expands back to the DiskResult seek_sequence, start included
+    std::vector<int> decode() const;
+
+    friend class DiskScheduler;
+
+private:
+    int first = 0;
+    SeekSummary stats = {};
+    std::vector<int> runs;
+};
+
+class DiskScheduler {
+public:
+    DiskResult fcfs(std::vector<int> requests, int head);
+    DiskResult sstf(std::vector<int> requests, int head);
+    DiskResult scan(std::vector<int> requests, int head, int disk_size, int direction); // direction: 1 for high, 0 for low
+    DiskResult c_scan(std::vector<int> requests, int head, int disk_size);
+    // SCAN and C-SCAN that turn at the last request instead of the disk edge
+    DiskResult look(std::vector<int> requests, int head, int direction);
+    DiskResult c_look(std::vector<int> requests, int head);
+
+    // Sorts once and runs all six from the shared order; SCAN and LOOK
+    // start towards high cylinders, as C-SCAN and C-LOOK always do
+    DiskComparison compare_all(std::vector<int> requests, int head, int disk_size);
+
+    // Runs one DiskAlgorithm without building seek_sequence; output is a
+    // DiskOutput. direction and disk_size are used as by the methods above.
+    // An unknown algorithm or output gives an empty trace with moves = -1.
+    SeekTrace trace(std::vector<int> requests, int algorithm, int head, int disk_size, int direction, int output);
+    // Same, reading n int32 requests at a byte offset into linear memory
+    SeekTrace trace_array(uintptr_t requests, int n, int algorithm, int head, int disk_size, int direction, int output);
+};
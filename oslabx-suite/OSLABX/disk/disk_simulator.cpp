@@ -0,0 +1,209 @@
+#include <cmath>
+#include <climits>
+#include <cstdint>
+#include <deque>
+#include <set>
+#include <algorithm>
+#include "disk_simulator.h"
+
+namespace {
+
+// Requests waiting for the head. Indices are arrival ranks, so every tie
+// goes to the request that arrived first.
+class DiskQueue {
+public:
+    DiskQueue(int policy, int batch_size, const std::vector<DiskRequest>& requests, const std::vector<int>& order)
+        : policy(policy), batch_size(std::max(batch_size, 1)), requests(requests), order(order) {}
+
+    bool empty() const { return waiting.empty() && sweep.empty(); }
+
+    void add(int rank) {
+        switch (policy) {
+            case DISK_SIM_FCFS:
+            case DISK_SIM_N_STEP_SCAN:
+            case DISK_SIM_FSCAN:
+                waiting.push_back(rank);
+                break;
+            case DISK_SIM_DEADLINE:
+                if (request(rank).deadline > 0) by_deadline.insert({request(rank).deadline, rank});
+                sweep.insert({request(rank).cylinder, rank});
+                break;
+            default:
+                sweep.insert({request(rank).cylinder, rank});
+                break;
+        }
+    }
+
+    // Removes and returns the next request to serve
+    int next(int head, double now) {
+        switch (policy) {
+            case DISK_SIM_FCFS: {
+                int rank = waiting.front();
+                waiting.pop_front();
+                return rank;
+            }
+            case DISK_SIM_SSTF: return take(nearest(head));
+            case DISK_SIM_C_LOOK: return take(upwards(head));
+            case DISK_SIM_N_STEP_SCAN:
+            case DISK_SIM_FSCAN:
+                if (sweep.empty()) {
+                    // Freeze the next batch; later arrivals wait for the sweep after
+                    size_t n = policy == DISK_SIM_FSCAN ? waiting.size() : std::min(waiting.size(), (size_t)batch_size);
+                    for (size_t i = 0; i < n; ++i) {
+                        sweep.insert({request(waiting.front()).cylinder, waiting.front()});
+                        waiting.pop_front();
+                    }
+                }
+                return take(look(head));
+            case DISK_SIM_DEADLINE:
+                if (!by_deadline.empty() && by_deadline.begin()->first <= now) {
+                    int rank = by_deadline.begin()->second;
+                    sweep.erase({request(rank).cylinder, rank});
+                    by_deadline.erase(by_deadline.begin());
+                    return rank;
+                }
+                return take(upwards(head));
+            default: return take(look(head));
+        }
+    }
+
+private:
+    using Entry = std::set<std::pair<int, int>>::iterator;
+
+    const DiskRequest& request(int rank) const { return requests[order[rank]]; }
+
+    int take(Entry it) {
+        int rank = it->second;
+        sweep.erase(it);
+        if (policy == DISK_SIM_DEADLINE && request(rank).deadline > 0) by_deadline.erase({request(rank).deadline, rank});
+        return rank;
+    }
+
+    // Closest cylinder at or above head, wrapping round to the lowest
+    Entry upwards(int head) {
+        auto it = sweep.lower_bound({head, INT_MIN});
+        return it != sweep.end() ? it : sweep.begin();
+    }
+
+    // Closest cylinder in the current direction, turning when there is none
+    Entry look(int head) {
+        if (going_up) {
+            auto it = sweep.lower_bound({head, INT_MIN});
+            if (it != sweep.end()) return it;
+            going_up = false;
+        }
+        auto it = sweep.upper_bound({head, INT_MAX});
+        if (it != sweep.begin()) return lowest_rank_at(std::prev(it));
+        going_up = true;
+        return sweep.lower_bound({head, INT_MIN});
+    }
+
+    // Going down, the entry found is the last at its cylinder; serve that
+    // cylinder's earliest arrival instead
+    Entry lowest_rank_at(Entry it) { return sweep.lower_bound({it->first, INT_MIN}); }
+
+    Entry nearest(int head) {
+        auto above = sweep.lower_bound({head, INT_MIN});
+        if (above == sweep.begin()) return above;
+        auto below = lowest_rank_at(std::prev(above));
+        if (above == sweep.end()) return below;
+        long long down = (long long)head - below->first, up = (long long)above->first - head;
+        if (down != up) return down < up ? below : above;
+        return below->second < above->second ? below : above;
+    }
+
+    int policy;
+    int batch_size;
+    const std::vector<DiskRequest>& requests;
+    const std::vector<int>& order;
+    std::deque<int> waiting;                     // FCFS queue, or arrivals held for the next sweep
+    std::set<std::pair<int, int>> sweep;         // (cylinder, rank) eligible for the head now
+    std::set<std::pair<double, int>> by_deadline;
+    bool going_up = true;
+};
+
+double percentile(std::vector<double>& values, double p) {
+    if (values.empty()) return 0;
+    size_t k = std::min(values.size() - 1, (size_t)std::ceil(p * values.size()) - (p > 0));
+    std::nth_element(values.begin(), values.begin() + k, values.end());
+    return values[k];
+}
+
+} // namespace
+
+DiskModel default_disk_model() {
+    return {1.0, 0.08, 7200, 0.1};
+}
+
+DiskSimResult simulate_disk(const std::vector<DiskRequest>& requests, int policy, const DiskModel& model, int head,
+                            int batch_size) {
+    int n = requests.size();
+    DiskSimResult result = {};
+    result.requests.resize(n);
+    if (n == 0) return result;
+
+    std::vector<int> order(n);
+    for (int i = 0; i < n; ++i) order[i] = i;
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+        return requests[a].arrival_time < requests[b].arrival_time;
+    });
+
+    double rotation_ms = model.rpm > 0 ? 60000.0 / model.rpm : 0;
+    DiskQueue queue(policy, batch_size, requests, order);
+    double now = requests[order[0]].arrival_time;
+    double busy = 0;
+    long long distance = 0;
+    int next = 0; // Arrival cursor over order
+
+    for (int served = 0; served < n; ++served) {
+        if (queue.empty()) now = std::max(now, requests[order[next]].arrival_time);
+        while (next < n && requests[order[next]].arrival_time <= now) queue.add(next++);
+
+        const DiskRequest& r = requests[order[queue.next(head, now)]];
+        int d = std::abs(r.cylinder - head);
+        double seek = d == 0 ? 0 : model.settle_ms + model.seek_factor_ms * std::sqrt((double)d);
+        double rotation = 0;
+        if (rotation_ms > 0) {
+            // Wait for the request's sector to come round once the seek is done
+            double sector = (uint32_t)(r.id * 2654435761u) / 4294967296.0;
+            double angle = std::fmod(now + seek, rotation_ms) / rotation_ms;
+            rotation = (sector >= angle ? sector - angle : 1 - angle + sector) * rotation_ms;
+        }
+        double service = seek + rotation + model.transfer_ms;
+
+        DiskCompletion& c = result.requests[&r - requests.data()];
+        c.id = r.id;
+        c.start_time = now;
+        c.finish_time = now + service;
+        c.latency = c.finish_time - r.arrival_time;
+        c.missed_deadline = r.deadline > 0 && c.finish_time > r.deadline;
+        result.missed_deadlines += c.missed_deadline;
+
+        now = c.finish_time;
+        busy += service;
+        distance += d;
+        head = r.cylinder;
+    }
+
+    std::vector<double> latencies(n);
+    double total = 0, first_arrival = requests[order[0]].arrival_time;
+    for (int i = 0; i < n; ++i) {
+        latencies[i] = result.requests[i].latency;
+        total += latencies[i];
+    }
+    result.mean_latency = total / n;
+    result.p50_latency = percentile(latencies, 0.50);
+    result.p95_latency = percentile(latencies, 0.95);
+    result.p99_latency = percentile(latencies, 0.99);
+    result.max_latency = *std::max_element(latencies.begin(), latencies.end());
+    double span = now - first_arrival;
+    result.throughput = span > 0 ? n / (span / 1000) : 0;
+    result.utilisation = span > 0 ? busy / span : 0;
+    result.mean_seek_distance = (double)distance / n;
+    return result;
+}
+
+DiskSimResult DiskSimulator::simulate(std::vector<DiskRequest> requests, int policy, DiskModel model, int head,
+                                      int batch_size) {
+    return simulate_disk(requests, policy, model, head, batch_size);
+}
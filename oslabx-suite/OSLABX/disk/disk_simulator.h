@@ -0,0 +1,72 @@
+#pragma once
+
+#include <vector>
+
+// Discrete-event disk simulator. Unlike DiskScheduler, where every request
+// is queued at time zero and cost is cylinder distance, requests arrive over
+// time and each one is served for seek + rotational latency + transfer time.
+// Times are in milliseconds.
+
+enum DiskSimPolicy {
+    DISK_SIM_FCFS = 0,
+    DISK_SIM_SSTF = 1,
+    DISK_SIM_LOOK = 2,
+    DISK_SIM_C_LOOK = 3,
+    DISK_SIM_N_STEP_SCAN = 4,
+    DISK_SIM_FSCAN = 5,
+    DISK_SIM_DEADLINE = 6
+};
+
+struct DiskRequest {
+    int id;
+    double arrival_time;
+    int cylinder;
+    double deadline; // Absolute completion deadline, <= 0 for none
+};
+
+struct DiskModel {
+    double settle_ms;      // Fixed part of any non-zero seek
+    double seek_factor_ms; // Seek time grows with sqrt(distance) times this
+    double rpm;
+    double transfer_ms;
+};
+
+// Roughly a 7200 rpm drive: 1 ms settle, about 9 ms for a 10000 cylinder seek
+DiskModel default_disk_model();
+
+struct DiskCompletion {
+    int id;
+    double start_time;
+    double finish_time;
+    double latency; // finish - arrival
+    bool missed_deadline;
+};
+
+struct DiskSimResult {
+    std::vector<DiskCompletion> requests; // In input order
+    double mean_latency;
+    double p50_latency;
+    double p95_latency;
+    double p99_latency;
+    double max_latency;
+    double throughput;  // Requests per second over the run
+    double utilisation; // Busy time over the run
+    double mean_seek_distance;
+    int missed_deadlines;
+};
+
+// head is the starting cylinder. batch_size is N for N-step SCAN.
+// LOOK sweeps back and forth, turning at the last request; C-LOOK only
+// serves upwards and jumps back to the lowest request. N-step SCAN freezes
+// the next N arrivals into a batch and sweeps it LOOK-style, as FSCAN does
+// with everything that queued during the previous sweep. DEADLINE runs a
+// C-LOOK elevator but serves the request with the earliest deadline first
+// whenever that deadline has passed. Each request's sector is fixed by its
+// id, and the platter keeps turning while the head is idle.
+DiskSimResult simulate_disk(const std::vector<DiskRequest>& requests, int policy, const DiskModel& model, int head,
+                            int batch_size);
+
+class DiskSimulator {
+public:
+    DiskSimResult simulate(std::vector<DiskRequest> requests, int policy, DiskModel model, int head, int batch_size);
+};
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <map>
+#include <algorithm>
+#include <climits>
+
+struct FileInfo {
+    int id;
+    int size;
+    // For Contiguous: start block, length
+    int startBlock;
+    int length;
+    // For Linked/Indexed: list of blocks
+    std::vector<int> blocks;
+};
+
+struct DiskBlock {
+    int id;
+    int fileId; // -1 if free
+    int nextBlock; // For linked allocation, -1 if end or not used
+};
+
+struct AllocationResult {
+    std::vector<DiskBlock> disk;
+    std::vector<FileInfo> files;
+    bool success;
+};
+
+class FileAllocationManager {
+public:
+    AllocationResult contiguous(int totalBlocks, std::vector<FileInfo> filesRequest);
+    AllocationResult linked(int totalBlocks, std::vector<FileInfo> filesRequest);
+    AllocationResult indexed(int totalBlocks, std::vector<FileInfo> filesRequest);
+};
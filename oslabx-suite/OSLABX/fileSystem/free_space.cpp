@@ -0,0 +1,164 @@
+#include <algorithm>
+#include "free_space.h"
+
+FreeSpaceBitmap::FreeSpaceBitmap(int blocks) : blocks(std::max(blocks, 0)), free_blocks(std::max(blocks, 0)) {
+    int words = (this->blocks + 63) / 64;
+    bits.assign(words, ~0ULL);
+    // Blocks past the end of the disk stay in use forever
+    if (this->blocks % 64) bits[words - 1] = (1ULL << (this->blocks % 64)) - 1;
+    nonempty.assign((words + 63) / 64, 0);
+    for (int w = 0; w < words; ++w) nonempty[w >> 6] |= 1ULL << (w & 63);
+
+    leaves = 1;
+    while (leaves < words) leaves <<= 1;
+    tree.assign(2 * leaves, {0, 0, 0});
+    is_dirty.assign(words, false);
+    for (int w = 0; w < words; ++w) touch(w);
+    flush();
+}
+
+int FreeSpaceBitmap::allocate_block() {
+    for (int i = lowest_word >> 6; i < (int)nonempty.size(); ++i) {
+        if (nonempty[i] == 0) continue;
+        int w = (i << 6) + __builtin_ctzll(nonempty[i]);
+        int block = (w << 6) + __builtin_ctzll(bits[w]);
+        bits[w] &= bits[w] - 1;
+        if (bits[w] == 0) nonempty[i] &= ~(1ULL << (w & 63));
+        lowest_word = w;
+        free_blocks--;
+        touch(w);
+        return block;
+    }
+    lowest_word = bits.size();
+    return -1;
+}
+
+int FreeSpaceBitmap::find_run(int length) {
+    if (length <= 0) return -1;
+    flush();
+    if (tree[1].best < length) return -1;
+
+    int node = 1;
+    long long node_length = 64LL * leaves;
+    long long start = 0;
+    while (node < leaves) {
+        long long half = node_length / 2;
+        const Node& low = tree[2 * node];
+        const Node& high = tree[2 * node + 1];
+        if (low.best >= length) node = 2 * node;
+        else if (low.suffix + high.prefix >= length) return start + half - low.suffix;
+        else {
+            node = 2 * node + 1;
+            start += half;
+        }
+        node_length = half;
+    }
+
+    // The run lies inside this word: bit i of `fits` ends up set when bits
+    // i .. i + length - 1 are all free
+    uint64_t fits = bits[node - leaves];
+    for (int covered = 1; covered < length;) {
+        int shift = std::min(covered, length - covered);
+        fits &= fits >> shift;
+        covered += shift;
+    }
+    return start + __builtin_ctzll(fits);
+}
+
+int FreeSpaceBitmap::allocate_run(int length) {
+    int start = find_run(length);
+    if (start >= 0) allocate_range(start, length);
+    return start;
+}
+
+int FreeSpaceBitmap::largest_free_run() {
+    flush();
+    return tree[1].best;
+}
+
+void FreeSpaceBitmap::allocate_range(int start, int length) {
+    set_range(start, length, false);
+}
+
+void FreeSpaceBitmap::release_range(int start, int length) {
+    set_range(start, length, true);
+}
+
+void FreeSpaceBitmap::set_range(int start, int length, bool free) {
+    int end = std::min((long long)blocks, (long long)start + length);
+    start = std::max(start, 0);
+    if (start >= end) return;
+    if (free) lowest_word = std::min(lowest_word, start >> 6);
+
+    for (int w = start >> 6; w <= (end - 1) >> 6; ++w) {
+        int lo = std::max(start - (w << 6), 0);
+        int hi = std::min(end - (w << 6), 64);
+        uint64_t mask = (hi == 64 ? ~0ULL : (1ULL << hi) - 1) & ~((1ULL << lo) - 1);
+        int was_free = __builtin_popcountll(bits[w] & mask);
+        if (free) {
+            bits[w] |= mask;
+            free_blocks += __builtin_popcountll(mask) - was_free;
+        } else {
+            bits[w] &= ~mask;
+            free_blocks -= was_free;
+        }
+        if (bits[w]) nonempty[w >> 6] |= 1ULL << (w & 63);
+        else nonempty[w >> 6] &= ~(1ULL << (w & 63));
+        touch(w);
+    }
+}
+
+void FreeSpaceBitmap::touch(int word) {
+    if (is_dirty[word]) return;
+    is_dirty[word] = true;
+    dirty.push_back(word);
+}
+
+void FreeSpaceBitmap::flush() {
+    if (dirty.empty()) return;
+    int depth = __builtin_ctz(leaves);
+    for (int w : dirty) {
+        tree[leaves + w] = leaf(bits[w]);
+        is_dirty[w] = false;
+    }
+
+    if ((long long)dirty.size() * depth > leaves) {
+        // Cheaper to rebuild every level than to walk each dirty path
+        int length = 64;
+        for (int first = leaves / 2; first >= 1; first /= 2, length *= 2) {
+            for (int node = first; node < 2 * first; ++node) {
+                tree[node] = combine(tree[2 * node], tree[2 * node + 1], length);
+            }
+        }
+    } else {
+        for (int w : dirty) {
+            int length = 64;
+            for (int node = (leaves + w) / 2; node >= 1; node /= 2, length *= 2) {
+                tree[node] = combine(tree[2 * node], tree[2 * node + 1], length);
+            }
+        }
+    }
+    dirty.clear();
+}
+
+FreeSpaceBitmap::Node FreeSpaceBitmap::leaf(uint64_t word) const {
+    if (word == ~0ULL) return {64, 64, 64};
+    if (word == 0) return {0, 0, 0};
+    Node n = {__builtin_ctzll(~word), __builtin_clzll(~word), 0};
+    // Walk the runs of set bits from the bottom
+    while (word) {
+        word >>= __builtin_ctzll(word);
+        int run = __builtin_ctzll(~word);
+        n.best = std::max(n.best, run);
+        word >>= run;
+    }
+    return n;
+}
+
+FreeSpaceBitmap::Node FreeSpaceBitmap::combine(const Node& low, const Node& high, int low_length) const {
+    Node n;
+    n.prefix = low.prefix == low_length ? low_length + high.prefix : low.prefix;
+    n.suffix = high.suffix == low_length ? low_length + low.suffix : high.suffix;
+    n.best = std::max({low.best, high.best, low.suffix + high.prefix});
+    return n;
+}
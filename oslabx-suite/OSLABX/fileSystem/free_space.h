@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// Free-space map for a disk of fixed-size blocks: one bit per block, set
+// when the block is free, packed 64 to a word.
+//
+// Single blocks come from a second bitmap with one bit per word that still
+// has a free block, scanned with count-trailing-zeros from the lowest word
+// that may have one, so taking the lowest free block is O(1) amortised.
+// Contiguous runs come from a segment tree over the words, holding each
+// node's free prefix, free suffix and longest free run. Changes only mark
+// their words dirty; the tree catches up on the next run query, so block at
+// a time allocation never pays for it.
+class FreeSpaceBitmap {
+public:
+    explicit FreeSpaceBitmap(int blocks); // Every block starts free
+
+    int size() const { return blocks; }
+    int free_count() const { return free_blocks; }
+    bool is_free(int block) const { return bits[block >> 6] >> (block & 63) & 1; }
+
+    // Lowest free block, now in use; -1 when the disk is full
+    int allocate_block();
+    // Start of the lowest run of `length` free blocks, or -1
+    int find_run(int length);
+    // find_run, then marks the run in use
+    int allocate_run(int length);
+    int largest_free_run();
+
+    // Both ranges are [start, start + length); blocks already in that state are left alone
+    void allocate_range(int start, int length);
+    void release_range(int start, int length);
+    void release(int block) { release_range(block, 1); }
+
+private:
+    struct Node {
+        int prefix; // Free blocks at the low end
+        int suffix; // Free blocks at the high end
+        int best;   // Longest free run anywhere inside
+    };
+
+    // Sets bits [start, start + length) to `free`, keeping counters in step
+    void set_range(int start, int length, bool free);
+    void touch(int word);
+    void flush();
+    Node leaf(uint64_t word) const;
+    Node combine(const Node& low, const Node& high, int low_length) const;
+
+    int blocks;
+    int free_blocks;
+    std::vector<uint64_t> bits;
+    std::vector<uint64_t> nonempty; // Bit w % 64 of word w / 64: bits[w] has a free block
+    int lowest_word = 0;            // No free block below this word
+
+    int leaves;                     // Power of two >= bits.size()
+    std::vector<Node> tree;         // Heap order, root at 1, leaf w at leaves + w
+    std::vector<int> dirty;         // Words changed since the last flush
+    std::vector<bool> is_dirty;
+};
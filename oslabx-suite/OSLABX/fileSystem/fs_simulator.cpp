@@ -0,0 +1,248 @@
+#include <algorithm>
+#include <unordered_map>
+#include "fs_simulator.h"
+#include "free_space.h"
+
+namespace {
+
+struct Extent {
+    int start;
+    int length;
+};
+
+struct FsFile {
+    std::vector<Extent> extents; // In file order
+    int size = 0;                // Data blocks
+    int index_block = -1;        // Indexed layout only
+};
+
+class FileSystem {
+public:
+    FileSystem(int layout, int total_blocks) : layout(layout), total_blocks(std::max(total_blocks, 0)), space(total_blocks) {}
+
+    bool has(int id) const { return files.count(id) > 0; }
+
+    bool create(int id, int blocks) {
+        blocks = std::max(blocks, 0);
+        int needed = blocks + (layout == FS_INDEXED);
+        if (space.free_count() < needed) return false;
+        if (layout == FS_CONTIGUOUS && blocks > 0 && space.find_run(blocks) < 0) return false;
+
+        FsFile& f = files[id];
+        if (layout == FS_INDEXED) f.index_block = space.allocate_block();
+        grow(f, blocks);
+        return true;
+    }
+
+    bool append(int id, int blocks) {
+        auto it = files.find(id);
+        if (it == files.end() || blocks <= 0) return true;
+        FsFile& f = it->second;
+        if (space.free_count() < blocks) return false;
+        if (layout == FS_CONTIGUOUS) {
+            bool fits = f.extents.empty() ? space.find_run(blocks) >= 0
+                                          : free_after(f.extents[0], blocks) || space.find_run(f.size + blocks) >= 0;
+            if (!fits) return false;
+        }
+        grow(f, blocks);
+        return true;
+    }
+
+    void truncate(int id, int blocks) {
+        auto it = files.find(id);
+        if (it == files.end()) return;
+        FsFile& f = it->second;
+        int before = f.extents.size();
+        while (f.size > std::max(blocks, 0)) {
+            Extent& last = f.extents.back();
+            int cut = std::min(last.length, f.size - std::max(blocks, 0));
+            space.release_range(last.start + last.length - cut, cut);
+            last.length -= cut;
+            f.size -= cut;
+            if (last.length == 0) f.extents.pop_back();
+        }
+        count_extents(before, f.extents.size());
+    }
+
+    bool remove(int id) {
+        auto it = files.find(id);
+        if (it == files.end()) return false;
+        FsFile& f = it->second;
+        count_extents(f.extents.size(), 0);
+        for (const Extent& e : f.extents) space.release_range(e.start, e.length);
+        if (f.index_block >= 0) space.release(f.index_block);
+        files.erase(it);
+        return true;
+    }
+
+    // Packs every file from block 0; returns the blocks that had to move
+    int defragment() {
+        std::vector<std::pair<int, FsFile*>> order;
+        for (auto& [id, f] : files) {
+            int first = f.index_block >= 0 ? f.index_block : f.extents.empty() ? -1 : f.extents[0].start;
+            if (first >= 0) order.push_back({first, &f});
+        }
+        std::sort(order.begin(), order.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+        int cursor = 0, moved = 0;
+        for (auto& [first, f] : order) {
+            if (f->index_block >= 0) {
+                moved += f->index_block != cursor;
+                f->index_block = cursor++;
+            }
+            int offset = 0;
+            for (const Extent& e : f->extents) {
+                if (e.start != cursor + offset) moved += e.length;
+                offset += e.length;
+            }
+            f->extents.clear();
+            if (f->size > 0) f->extents.push_back({cursor, f->size});
+            cursor += f->size;
+        }
+
+        total_extents = 0;
+        fragmented = 0;
+        for (auto& entry : order) total_extents += entry.second->extents.size();
+        space = FreeSpaceBitmap(total_blocks);
+        space.allocate_range(0, cursor);
+        return moved;
+    }
+
+    FsSample sample(int event, int failures) {
+        FsSample s;
+        s.event = event;
+        s.files = files.size();
+        s.free_blocks = space.free_count();
+        s.used_blocks = total_blocks - s.free_blocks;
+        s.largest_free_run = space.largest_free_run();
+        s.external_fragmentation = s.free_blocks > 0 ? 1 - (double)s.largest_free_run / s.free_blocks : 0;
+        s.mean_extents = non_empty_files > 0 ? (double)total_extents / non_empty_files : 0;
+        s.fragmented_files = fragmented;
+        s.failures = failures;
+        return s;
+    }
+
+    int relocated = 0;
+
+private:
+    // Callers have checked there is room, including a long enough run for contiguous files
+    void grow(FsFile& f, int blocks) {
+        if (blocks <= 0) return;
+        int before = f.extents.size();
+        f.size += blocks;
+        switch (layout) {
+            case FS_CONTIGUOUS:
+                if (f.extents.empty()) f.extents.push_back({space.allocate_run(blocks), blocks});
+                else if (free_after(f.extents[0], blocks)) {
+                    space.allocate_range(f.extents[0].start + f.extents[0].length, blocks);
+                    f.extents[0].length += blocks;
+                } else {
+                    // Copy the file to a run that fits it whole, then let the old one go
+                    Extent old = f.extents[0];
+                    f.extents[0] = {space.allocate_run(f.size), f.size};
+                    space.release_range(old.start, old.length);
+                    relocated += old.length;
+                }
+                break;
+            case FS_EXTENT:
+                if (!f.extents.empty()) {
+                    Extent& last = f.extents.back();
+                    int end = last.start + last.length;
+                    int n = 0;
+                    while (n < blocks && end + n < total_blocks && space.is_free(end + n)) n++;
+                    space.allocate_range(end, n);
+                    last.length += n;
+                    blocks -= n;
+                }
+                while (blocks > 0) {
+                    int length = blocks;
+                    int start = space.find_run(length);
+                    if (start < 0) {
+                        length = space.largest_free_run();
+                        start = space.find_run(length);
+                    }
+                    space.allocate_range(start, length);
+                    f.extents.push_back({start, length});
+                    blocks -= length;
+                }
+                break;
+            default:
+                for (int i = 0; i < blocks; ++i) {
+                    int block = space.allocate_block();
+                    if (!f.extents.empty() && f.extents.back().start + f.extents.back().length == block) {
+                        f.extents.back().length++;
+                    } else {
+                        f.extents.push_back({block, 1});
+                    }
+                }
+                break;
+        }
+        count_extents(before, f.extents.size());
+    }
+
+    bool free_after(const Extent& e, int blocks) {
+        int end = e.start + e.length;
+        if ((long long)end + blocks > total_blocks) return false;
+        for (int b = end; b < end + blocks; ++b) {
+            if (!space.is_free(b)) return false;
+        }
+        return true;
+    }
+
+    void count_extents(int before, int after) {
+        total_extents += after - before;
+        non_empty_files += (after > 0) - (before > 0);
+        fragmented += (after > 1) - (before > 1);
+    }
+
+    int layout;
+    int total_blocks;
+    FreeSpaceBitmap space;
+    std::unordered_map<int, FsFile> files;
+    long long total_extents = 0;
+    int non_empty_files = 0;
+    int fragmented = 0;
+};
+
+} // namespace
+
+FsResult simulate_file_system(const std::vector<FsEvent>& events, int layout, int total_blocks, int sample_interval) {
+    FsResult result = {};
+    if (sample_interval > 0) result.samples.reserve(events.size() / sample_interval + 1);
+    FileSystem fs(layout, total_blocks);
+
+    int n = events.size();
+    for (int i = 0; i < n; ++i) {
+        const FsEvent& e = events[i];
+        switch (e.type) {
+            case FS_CREATE:
+                if (fs.has(e.file)) break;
+                if (fs.create(e.file, e.blocks)) result.creates++;
+                else result.failures++;
+                break;
+            case FS_APPEND:
+                if (!fs.append(e.file, e.blocks)) result.failures++;
+                break;
+            case FS_TRUNCATE:
+                fs.truncate(e.file, e.blocks);
+                break;
+            case FS_DELETE:
+                result.deletes += fs.remove(e.file);
+                break;
+            case FS_DEFRAG:
+                result.defrag_passes++;
+                result.defrag_moved_blocks += fs.defragment();
+                break;
+        }
+        if ((sample_interval > 0 && (i + 1) % sample_interval == 0) || i + 1 == n) {
+            result.samples.push_back(fs.sample(i + 1, result.failures));
+        }
+    }
+    if (n == 0) result.samples.push_back(fs.sample(0, 0));
+    result.relocated_blocks = fs.relocated;
+    return result;
+}
+
+FsResult FileSystemSimulator::simulate(std::vector<FsEvent> events, int layout, int total_blocks, int sample_interval) {
+    return simulate_file_system(events, layout, total_blocks, sample_interval);
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <vector>
+
+// Stateful file-system aging simulator.
+//
+// Unlike FileAllocationManager, which lays out one batch of files on an
+// empty disk, this replays creates, appends, truncates and deletes against
+// one disk for as long as the stream runs, and samples how fragmented the
+// files and the free space get. Sizes are in blocks.
+
+enum FsEventType {
+    FS_CREATE = 0,   // New file `file` of `blocks` blocks
+    FS_APPEND = 1,   // Grow `file` by `blocks`
+    FS_TRUNCATE = 2, // Shrink `file` to `blocks`; growing is a no-op, as a sparse extension would be
+    FS_DELETE = 3,
+    FS_DEFRAG = 4    // Run a defragmentation pass (file and blocks unused)
+};
+
+// Events on files that don't exist, and creates of ones that do, are ignored
+struct FsEvent {
+    int type;
+    int file;
+    int blocks;
+};
+
+enum FsLayout {
+    FS_CONTIGUOUS = 0, // One run per file; a file that can't grow in place is copied to a new run
+    FS_LINKED = 1,     // Lowest free block, one at a time
+    FS_INDEXED = 2,    // As linked, plus one index block per file
+    FS_EXTENT = 3      // Grow the last extent in place, then first fit, splitting only when no run is long enough
+};
+
+// Disk state after `event` events
+struct FsSample {
+    int event;
+    int files;
+    int used_blocks;      // Index blocks included
+    int free_blocks;
+    int largest_free_run;
+    double external_fragmentation; // 1 - largest_free_run / free_blocks
+    double mean_extents;           // Contiguous pieces per non-empty file
+    int fragmented_files;          // Files in more than one piece
+    int failures;                  // Creates and appends that found no room so far
+};
+
+struct FsResult {
+    std::vector<FsSample> samples;
+    int creates; // Successful ones
+    int deletes;
+    int failures;
+    int relocated_blocks; // Copied by contiguous files moving to grow
+    int defrag_passes;
+    int defrag_moved_blocks; // Each is one block read and one block write
+};
+
+// A defragmentation pass packs every file into one run from block 0, in the
+// order of its current first block, index block first. A block counts as
+// moved unless it already sits at its packed position. A sample is taken
+// every sample_interval events (<= 0: only at the end) and after the last.
+FsResult simulate_file_system(const std::vector<FsEvent>& events, int layout, int total_blocks, int sample_interval);
+
+class FileSystemSimulator {
+public:
+    FsResult simulate(std::vector<FsEvent> events, int layout, int total_blocks, int sample_interval);
+};
@@ -0,0 +1,562 @@
+#include <set>
+#include <climits>
+#include <algorithm>
+#include <unordered_map>
+#include "allocator.h"
+
+namespace {
+
+// Free blocks in address order, in a treap augmented with each subtree's
+// largest block and block count. First and next fit become a descent to the
+// leftmost block that fits, and the count still gives the search length a
+// sequential free-list walk would have had.
+class FreeTree {
+public:
+    int size() const { return count_in(root); }
+    int largest() const { return max_in(root); }
+
+    void insert(int addr, int size) {
+        int node;
+        if (free_nodes.empty()) {
+            node = nodes.size();
+            nodes.push_back({});
+        } else {
+            node = free_nodes.back();
+            free_nodes.pop_back();
+        }
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        nodes[node] = {addr, size, seed, -1, -1, size, 1};
+        root = insert_at(root, node);
+    }
+
+    void erase(int addr) { root = erase_at(root, addr); }
+
+    // Leftmost block starting at or after `from` with at least `bytes` bytes,
+    // as (start, blocks walked up to and including it). With no fit the
+    // start is -1 and the walk covers every block from `from` on.
+    std::pair<int, int> first_fit(int bytes, int from) const {
+        int found = find(root, bytes, from);
+        if (found == -1) return {-1, count_in(root) - before(from)};
+        return {nodes[found].addr, before(nodes[found].addr + 1) - before(from)};
+    }
+
+private:
+    struct Node {
+        int addr, size;
+        unsigned prio;
+        int left, right;
+        int max_size, count; // Over the subtree
+    };
+
+    int count_in(int t) const { return t == -1 ? 0 : nodes[t].count; }
+    int max_in(int t) const { return t == -1 ? 0 : nodes[t].max_size; }
+
+    // Node of the leftmost block in t starting at or after `from` with at
+    // least `size` bytes, -1 if none
+    int find(int t, int size, int from) const {
+        while (t != -1 && max_in(t) >= size) {
+            if (nodes[t].addr < from) {
+                t = nodes[t].right;
+                continue;
+            }
+            int left = find(nodes[t].left, size, from);
+            if (left != -1) return left;
+            if (nodes[t].size >= size) return t;
+            // Everything further right starts after `from`
+            from = INT_MIN;
+            t = nodes[t].right;
+        }
+        return -1;
+    }
+
+    // Number of blocks starting before addr
+    int before(int addr) const {
+        int n = 0;
+        for (int t = root; t != -1;) {
+            if (nodes[t].addr < addr) {
+                n += count_in(nodes[t].left) + 1;
+                t = nodes[t].right;
+            } else {
+                t = nodes[t].left;
+            }
+        }
+        return n;
+    }
+
+    void update(int t) {
+        Node& n = nodes[t];
+        n.count = 1 + count_in(n.left) + count_in(n.right);
+        n.max_size = std::max(n.size, std::max(max_in(n.left), max_in(n.right)));
+    }
+
+    int insert_at(int t, int node) {
+        if (t == -1) return node;
+        if (nodes[node].prio > nodes[t].prio) {
+            split(t, nodes[node].addr, nodes[node].left, nodes[node].right);
+            update(node);
+            return node;
+        }
+        if (nodes[node].addr < nodes[t].addr) nodes[t].left = insert_at(nodes[t].left, node);
+        else nodes[t].right = insert_at(nodes[t].right, node);
+        update(t);
+        return t;
+    }
+
+    int erase_at(int t, int addr) {
+        if (t == -1) return -1;
+        if (nodes[t].addr == addr) {
+            free_nodes.push_back(t);
+            return merge(nodes[t].left, nodes[t].right);
+        }
+        if (addr < nodes[t].addr) nodes[t].left = erase_at(nodes[t].left, addr);
+        else nodes[t].right = erase_at(nodes[t].right, addr);
+        update(t);
+        return t;
+    }
+
+    // less gets the blocks starting before addr, rest the others
+    void split(int t, int addr, int& less, int& rest) {
+        if (t == -1) {
+            less = rest = -1;
+        } else if (nodes[t].addr < addr) {
+            split(nodes[t].right, addr, nodes[t].right, rest);
+            less = t;
+            update(t);
+        } else {
+            split(nodes[t].left, addr, less, nodes[t].left);
+            rest = t;
+            update(t);
+        }
+    }
+
+    // Every block in a starts before every block in b
+    int merge(int a, int b) {
+        if (a == -1) return b;
+        if (b == -1) return a;
+        if (nodes[a].prio > nodes[b].prio) {
+            nodes[a].right = merge(nodes[a].right, b);
+            update(a);
+            return a;
+        }
+        nodes[b].left = merge(a, nodes[b].left);
+        update(b);
+        return b;
+    }
+
+    std::vector<Node> nodes;
+    std::vector<int> free_nodes;
+    int root = -1;
+    unsigned seed = 2463534242u;
+};
+
+// First, next, best or worst fit over one free list, splitting the chosen
+// block and coalescing with both neighbours on free. Free blocks are hashed
+// by start and end for coalescing; first and next fit search a FreeTree,
+// best and worst fit a set ordered by (size, address). A real best or worst
+// fit would scan the whole list, so that is their search length.
+class FitEngine {
+public:
+    FitEngine(int heap_size, int policy) : policy(policy) {
+        if (heap_size > 0) add_free(0, heap_size);
+    }
+
+    bool allocate(int id, int size, int& search) {
+        long long rounded = ((long long)size + 7) / 8 * 8;
+        if (rounded > free_total) {
+            search = free_blocks();
+            return false;
+        }
+        int bytes = rounded;
+        int addr = take(bytes, search);
+        if (addr == -1) return false;
+        owners[id] = {addr, bytes};
+        return true;
+    }
+
+    void release(int id) {
+        auto it = owners.find(id);
+        give(it->second.first, it->second.second);
+        owners.erase(it);
+    }
+
+    // Start of a block for `bytes`, which grows to the whole block when the
+    // leftover would be under 8 bytes; -1 if nothing fits
+    int take(int& bytes, int& search) {
+        int addr = -1, size = 0;
+        if (sized()) {
+            search = free_blocks();
+            if (by_size.empty() || by_size.rbegin()->first < bytes) return -1;
+            int want = policy == ALLOC_BEST_FIT ? bytes : by_size.rbegin()->first;
+            auto it = by_size.lower_bound({want, INT_MIN});
+            size = it->first;
+            addr = it->second;
+        } else {
+            int from = policy == ALLOC_NEXT_FIT ? rover : 0;
+            auto fit = tree.first_fit(bytes, from);
+            search = fit.second;
+            if (fit.first == -1 && from > 0) {
+                // Wrap around to the blocks before the rover
+                fit = tree.first_fit(bytes, 0);
+                search += fit.second;
+            }
+            if (fit.first == -1) {
+                search = free_blocks();
+                return -1;
+            }
+            addr = fit.first;
+            size = size_at[addr];
+        }
+
+        remove_free(addr, size);
+        if (size - bytes >= 8) add_free(addr + bytes, size - bytes);
+        else bytes = size;
+        rover = addr + bytes;
+        return addr;
+    }
+
+    void give(int addr, int bytes) {
+        auto after = size_at.find(addr + bytes);
+        if (after != size_at.end()) {
+            int size = after->second;
+            remove_free(addr + bytes, size);
+            bytes += size;
+        }
+        auto before = start_of_end.find(addr);
+        if (before != start_of_end.end()) {
+            int start = before->second;
+            int size = addr - start;
+            remove_free(start, size);
+            addr = start;
+            bytes += size;
+        }
+        add_free(addr, bytes);
+        // Don't leave the rover in the middle of a free block
+        if (rover > addr && rover < addr + bytes) rover = addr;
+    }
+
+    int free_bytes() const { return free_total; }
+    int free_blocks() const { return size_at.size(); }
+    int largest_free() const {
+        if (!sized()) return tree.largest();
+        return by_size.empty() ? 0 : by_size.rbegin()->first;
+    }
+
+private:
+    bool sized() const { return policy == ALLOC_BEST_FIT || policy == ALLOC_WORST_FIT; }
+
+    void add_free(int addr, int size) {
+        size_at[addr] = size;
+        start_of_end[addr + size] = addr;
+        if (sized()) by_size.insert({size, addr});
+        else tree.insert(addr, size);
+        free_total += size;
+    }
+
+    void remove_free(int addr, int size) {
+        size_at.erase(addr);
+        start_of_end.erase(addr + size);
+        if (sized()) by_size.erase({size, addr});
+        else tree.erase(addr);
+        free_total -= size;
+    }
+
+    int policy;
+    int free_total = 0;
+    int rover = 0; // Next fit resumes its search here
+    std::unordered_map<int, int> size_at;      // Free block start -> size
+    std::unordered_map<int, int> start_of_end; // Free block end -> start
+    FreeTree tree;                             // First and next fit
+    std::set<std::pair<int, int>> by_size;     // Best and worst fit
+    std::unordered_map<int, std::pair<int, int>> owners; // id -> (start, bytes)
+};
+
+// Binary buddy system over blocks of 16 << order bytes. A heap that isn't a
+// power of two is carved into the largest aligned blocks that fit. Search
+// length is the number of free lists looked at.
+class BuddyEngine {
+public:
+    explicit BuddyEngine(int heap_size) {
+        while (max_order < 30 && (16LL << (max_order + 1)) <= heap_size) max_order++;
+        lists.resize(max_order + 1);
+        long long addr = 0;
+        while (addr + 16 <= heap_size) {
+            int order = max_order;
+            while (order > 0 && (addr % (16LL << order) != 0 || addr + (16LL << order) > heap_size)) order--;
+            push(addr, order);
+            addr += 16LL << order;
+        }
+    }
+
+    bool allocate(int id, int size, int& search) {
+        int order = 0;
+        while (order <= max_order && (16LL << order) < size) order++;
+        int found = order;
+        while (found <= max_order && lists[found].empty()) found++;
+        search = std::min(found, max_order) - order + 1;
+        if (found > max_order) return false;
+
+        int addr = lists[found].back();
+        remove(addr);
+        // Split down, freeing the upper half each time
+        while (found > order) {
+            found--;
+            push(addr + (16 << found), found);
+        }
+        owners[id] = {addr, order};
+        return true;
+    }
+
+    void release(int id) {
+        auto it = owners.find(id);
+        int addr = it->second.first, order = it->second.second;
+        owners.erase(it);
+        while (order < max_order) {
+            int buddy = addr ^ (16 << order);
+            auto b = free_at.find(buddy);
+            if (b == free_at.end() || b->second.first != order) break;
+            remove(buddy);
+            addr = std::min(addr, buddy);
+            order++;
+        }
+        push(addr, order);
+    }
+
+    int free_bytes() const { return free_total; }
+    int free_blocks() const { return free_at.size(); }
+    int largest_free() const {
+        for (int order = max_order; order >= 0; --order) {
+            if (!lists[order].empty()) return 16 << order;
+        }
+        return 0;
+    }
+
+private:
+    void push(int addr, int order) {
+        free_at[addr] = {order, (int)lists[order].size()};
+        lists[order].push_back(addr);
+        free_total += 16 << order;
+    }
+
+    void remove(int addr) {
+        auto it = free_at.find(addr);
+        int order = it->second.first, pos = it->second.second;
+        int last = lists[order].back();
+        lists[order][pos] = last;
+        free_at[last].second = pos;
+        lists[order].pop_back();
+        free_at.erase(it);
+        free_total -= 16 << order;
+    }
+
+    int max_order = 0;
+    int free_total = 0;
+    std::vector<std::vector<int>> lists;                     // Free block starts per order
+    std::unordered_map<int, std::pair<int, int>> free_at;    // start -> (order, index in its list)
+    std::unordered_map<int, std::pair<int, int>> owners;     // id -> (start, order)
+};
+
+// Slab allocator: power-of-two object classes from 16 to 512 bytes, each
+// served from 4 KiB slabs taken from a first-fit heap, which also serves
+// larger requests directly. Each class keeps one empty slab cached instead
+// of handing it straight back. Search length is 1 for a slab with room,
+// plus the heap's search when a new slab is needed.
+class SlabEngine {
+public:
+    explicit SlabEngine(int heap_size) : heap(heap_size, ALLOC_FIRST_FIT), partial(classes) {}
+
+    bool allocate(int id, int size, int& search) {
+        if (size > max_object) {
+            if (!heap.allocate(id, size, search)) return false;
+            owners[id] = {-1, 0};
+            return true;
+        }
+        int cls = 0;
+        while ((min_object << cls) < size) cls++;
+
+        search = 1;
+        if (partial[cls].empty()) {
+            int heap_search = 0;
+            int bytes = slab_bytes;
+            int addr = heap.take(bytes, heap_search);
+            search += heap_search;
+            if (addr == -1) return false;
+            new_slab(addr, bytes, cls);
+        }
+        int s = partial[cls].back();
+        Slab& slab = slabs[s];
+        int object = slab.free_objects.back();
+        slab.free_objects.pop_back();
+        slab.used++;
+        if (slab.free_objects.empty()) unlist(s);
+        owners[id] = {s, object};
+        return true;
+    }
+
+    void release(int id) {
+        auto it = owners.find(id);
+        int s = it->second.first, object = it->second.second;
+        owners.erase(it);
+        if (s == -1) {
+            heap.release(id);
+            return;
+        }
+        Slab& slab = slabs[s];
+        if (slab.list_pos == -1) list(s);
+        slab.free_objects.push_back(object);
+        slab.used--;
+        if (slab.used == 0 && partial[slab.cls].size() > 1) {
+            unlist(s);
+            heap.give(slab.addr, slab.bytes);
+            free_slabs.push_back(s);
+        }
+    }
+
+    int free_bytes() const { return heap.free_bytes(); }
+    int free_blocks() const { return heap.free_blocks(); }
+    int largest_free() const { return heap.largest_free(); }
+
+private:
+    static const int min_object = 16;
+    static const int max_object = 512;
+    static const int classes = 6;
+    static const int slab_bytes = 4096;
+
+    struct Slab {
+        int addr, bytes;
+        int cls;
+        int used;
+        int list_pos; // Index in its class's partial list, -1 when full
+        std::vector<int> free_objects;
+    };
+
+    void new_slab(int addr, int bytes, int cls) {
+        int s;
+        if (free_slabs.empty()) {
+            s = slabs.size();
+            slabs.push_back({});
+        } else {
+            s = free_slabs.back();
+            free_slabs.pop_back();
+        }
+        Slab& slab = slabs[s];
+        slab.addr = addr;
+        slab.bytes = bytes;
+        slab.cls = cls;
+        slab.used = 0;
+        slab.free_objects.clear();
+        // Hand out the lowest objects first
+        for (int i = slab_bytes / (min_object << cls) - 1; i >= 0; --i) slab.free_objects.push_back(i);
+        list(s);
+    }
+
+    void list(int s) {
+        auto& l = partial[slabs[s].cls];
+        slabs[s].list_pos = l.size();
+        l.push_back(s);
+    }
+
+    void unlist(int s) {
+        auto& l = partial[slabs[s].cls];
+        int pos = slabs[s].list_pos;
+        l[pos] = l.back();
+        slabs[l[pos]].list_pos = pos;
+        l.pop_back();
+        slabs[s].list_pos = -1;
+    }
+
+    FitEngine heap;
+    std::vector<Slab> slabs;
+    std::vector<int> free_slabs;
+    std::vector<std::vector<int>> partial;              // Per class: slabs with a free object
+    std::unordered_map<int, std::pair<int, int>> owners; // id -> (slab, object); slab -1 for heap blocks
+};
+
+template <class Engine>
+void replay(Engine& engine, const std::vector<AllocEvent>& events, int heap_size, int sample_interval,
+            AllocatorResult& result) {
+    std::unordered_map<int, int> live; // id -> requested bytes
+    int requested = 0;
+    long long total_search = 0, window_search = 0;
+    int window_allocations = 0;
+
+    auto sample = [&](int event) {
+        int free_bytes = engine.free_bytes();
+        int reserved = std::max(heap_size, 0) - free_bytes;
+        int largest = engine.largest_free();
+        AllocSample s;
+        s.event = event;
+        s.requested = requested;
+        s.reserved = reserved;
+        s.free_blocks = engine.free_blocks();
+        s.largest_free = largest;
+        s.external_fragmentation = free_bytes > 0 ? 1 - (double)largest / free_bytes : 0;
+        s.internal_fragmentation = reserved > 0 ? (double)(reserved - requested) / reserved : 0;
+        s.mean_search_length = window_allocations > 0 ? (double)window_search / window_allocations : 0;
+        s.failures = result.failures;
+        result.samples.push_back(s);
+        window_search = 0;
+        window_allocations = 0;
+    };
+
+    int n = events.size();
+    for (int i = 0; i < n; ++i) {
+        const AllocEvent& e = events[i];
+        if (e.type == EVENT_ALLOC && !live.count(e.id)) {
+            int size = std::max(e.size, 1);
+            int search = 0;
+            bool ok = engine.allocate(e.id, size, search);
+            total_search += search;
+            window_search += search;
+            window_allocations++;
+            result.max_search_length = std::max(result.max_search_length, search);
+            if (ok) {
+                live[e.id] = size;
+                requested += size;
+                result.allocations++;
+                result.peak_requested = std::max(result.peak_requested, requested);
+                result.peak_reserved = std::max(result.peak_reserved, std::max(heap_size, 0) - engine.free_bytes());
+            } else {
+                result.failures++;
+            }
+        } else if (e.type == EVENT_FREE) {
+            auto it = live.find(e.id);
+            if (it != live.end()) {
+                engine.release(e.id);
+                requested -= it->second;
+                live.erase(it);
+                result.frees++;
+            }
+        }
+        if ((sample_interval > 0 && (i + 1) % sample_interval == 0) || i + 1 == n) sample(i + 1);
+    }
+    if (n == 0) sample(0);
+
+    int attempts = result.allocations + result.failures;
+    result.mean_search_length = attempts > 0 ? (double)total_search / attempts : 0;
+}
+
+} // namespace
+
+AllocatorResult simulate_allocator(const std::vector<AllocEvent>& events, int policy, int heap_size,
+                                   int sample_interval) {
+    AllocatorResult result = {};
+    if (sample_interval > 0) result.samples.reserve(events.size() / sample_interval + 1);
+    if (policy == ALLOC_BUDDY) {
+        BuddyEngine engine(heap_size);
+        replay(engine, events, heap_size, sample_interval, result);
+    } else if (policy == ALLOC_SLAB) {
+        SlabEngine engine(heap_size);
+        replay(engine, events, heap_size, sample_interval, result);
+    } else {
+        FitEngine engine(heap_size, policy);
+        replay(engine, events, heap_size, sample_interval, result);
+    }
+    return result;
+}
+
+AllocatorResult AllocatorSimulator::simulate(std::vector<AllocEvent> events, int policy, int heap_size,
+                                             int sample_interval) {
+    return simulate_allocator(events, policy, heap_size, sample_interval);
+}
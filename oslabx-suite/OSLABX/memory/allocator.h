@@ -0,0 +1,69 @@
+#pragma once
+
+#include <vector>
+
+// Event-driven heap allocator simulator.
+//
+// Unlike MemoryManager, which maps each request onto a whole block once,
+// this replays a stream of allocations and frees against one heap of
+// heap_size bytes, splitting and coalescing as it goes, and samples how
+// fragmented the heap gets over time.
+
+enum AllocEventType {
+    EVENT_ALLOC = 0,
+    EVENT_FREE = 1
+};
+
+// Allocation `id` of `size` bytes, or the free of allocation `id` (size unused).
+// Freeing an id that isn't live, e.g. one whose allocation failed, is ignored.
+struct AllocEvent {
+    int type;
+    int id;
+    int size;
+};
+
+enum AllocatorPolicy {
+    ALLOC_FIRST_FIT = 0,
+    ALLOC_NEXT_FIT = 1,
+    ALLOC_BEST_FIT = 2,
+    ALLOC_WORST_FIT = 3,
+    ALLOC_BUDDY = 4,
+    ALLOC_SLAB = 5
+};
+
+// Heap state after `event` events
+struct AllocSample {
+    int event;
+    int requested;      // Bytes asked for by live allocations
+    int reserved;       // Bytes not free: requested plus rounding and slab slack
+    int free_blocks;
+    int largest_free;
+    double external_fragmentation; // 1 - largest_free / free bytes
+    double internal_fragmentation; // (reserved - requested) / reserved
+    double mean_search_length;     // Over the allocations since the previous sample
+    int failures;                  // Failed allocations so far
+};
+
+struct AllocatorResult {
+    std::vector<AllocSample> samples;
+    int allocations; // Successful ones
+    int frees;
+    int failures;
+    int peak_requested;
+    int peak_reserved;
+    double mean_search_length;
+    int max_search_length;
+};
+
+// Replays events with one policy. Sizes are rounded up to 8 bytes for the
+// fit policies, to a power of two of at least 16 for buddy; the slab
+// allocator serves power-of-two classes up to 512 bytes from 4 KiB slabs and
+// sends larger requests to a first-fit heap underneath. A sample is taken
+// every sample_interval events (<= 0: only at the end) and after the last.
+AllocatorResult simulate_allocator(const std::vector<AllocEvent>& events, int policy, int heap_size,
+                                   int sample_interval);
+
+class AllocatorSimulator {
+public:
+    AllocatorResult simulate(std::vector<AllocEvent> events, int policy, int heap_size, int sample_interval);
+};
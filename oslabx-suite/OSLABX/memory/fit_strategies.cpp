@@ -1,118 +1,108 @@
-#include <iostream>
-#include <vector>
-#include <algorithm>
-#include <climits>
-#include <emscripten/bind.h>
+#include "fit_strategies.h"
 
-struct MemoryBlock {
-    int id;
-    int size;
-    bool allocated;
-    int process_id; // -1 if free
-};
-
-struct ProcessRequest {
-    int id;
-    int size;
-    bool allocated;
-    int block_id; // -1 if not allocated
-};
-
-struct AllocationResult {
-    std::vector<MemoryBlock> blocks;
-    std::vector<ProcessRequest> processes;
-};
+namespace {
 
-class MemoryManager {
+// Free block sizes in address order under a max-segment tree, so the
+// leftmost free block of at least some size is found in O(log n).
+// Allocated blocks read as INT_MIN.
+class FreeBlockTree {
 public:
-    AllocationResult first_fit(std::vector<MemoryBlock> blocks, std::vector<ProcessRequest> processes) {
-        for (auto& p : processes) {
-            for (auto& b : blocks) {
-                if (!b.allocated && b.size >= p.size) {
-                    b.allocated = true;
-                    b.process_id = p.id;
-                    p.allocated = true;
-                    p.block_id = b.id;
-                    break;
-                }
-            }
+    explicit FreeBlockTree(const std::vector<MemoryBlock>& blocks) {
+        leaves = 1;
+        while (leaves < (int)blocks.size()) leaves *= 2;
+        tree.assign(2 * leaves, INT_MIN);
+        for (int i = 0; i < (int)blocks.size(); ++i) {
+            if (!blocks[i].allocated) tree[leaves + i] = blocks[i].size;
         }
-        return {blocks, processes};
+        for (int i = leaves - 1; i >= 1; --i) tree[i] = std::max(tree[2 * i], tree[2 * i + 1]);
     }
 
-    AllocationResult best_fit(std::vector<MemoryBlock> blocks, std::vector<ProcessRequest> processes) {
-        for (auto& p : processes) {
-            int best_idx = -1;
-            int min_frag = INT_MAX;
-            for (int i=0; i<blocks.size(); ++i) {
-                if (!blocks[i].allocated && blocks[i].size >= p.size) {
-                    int frag = blocks[i].size - p.size;
-                    if (frag < min_frag) {
-                        min_frag = frag;
-                        best_idx = i;
-                    }
-                }
-            }
-            if (best_idx != -1) {
-                blocks[best_idx].allocated = true;
-                blocks[best_idx].process_id = p.id;
-                p.allocated = true;
-                p.block_id = blocks[best_idx].id;
-            }
+    int largest() const { return tree[1]; }
+
+    // Leftmost free block with size >= size, -1 if none
+    int leftmost(int size) const {
+        if (tree[1] == INT_MIN || tree[1] < size) return -1;
+        int node = 1;
+        while (node < leaves) {
+            node = tree[2 * node] >= size ? 2 * node : 2 * node + 1;
         }
-        return {blocks, processes};
+        return node - leaves;
     }
 
-    AllocationResult worst_fit(std::vector<MemoryBlock> blocks, std::vector<ProcessRequest> processes) {
-        for (auto& p : processes) {
-             int worst_idx = -1;
-             int max_frag = -1;
-             for (int i=0; i<blocks.size(); ++i) {
-                if (!blocks[i].allocated && blocks[i].size >= p.size) {
-                    int frag = blocks[i].size - p.size;
-                    if (frag > max_frag) {
-                        max_frag = frag;
-                        worst_idx = i;
-                    }
-                }
-             }
-
-             if (worst_idx != -1) {
-                blocks[worst_idx].allocated = true;
-                blocks[worst_idx].process_id = p.id;
-                p.allocated = true;
-                p.block_id = blocks[worst_idx].id;
-             }
-        }
-        return {blocks, processes};
+    void take(int idx) {
+        int node = leaves + idx;
+        tree[node] = INT_MIN;
+        for (node /= 2; node >= 1; node /= 2) tree[node] = std::max(tree[2 * node], tree[2 * node + 1]);
     }
+
+private:
+    int leaves;
+    std::vector<int> tree;
 };
 
-using namespace emscripten;
+void assign(MemoryBlock& b, ProcessRequest& p) {
+    b.allocated = true;
+    b.process_id = p.id;
+    p.allocated = true;
+    p.block_id = b.id;
+}
 
-EMSCRIPTEN_BINDINGS(memory_fit_module) {
-    value_object<MemoryBlock>("MemoryBlock")
-        .field("id", &MemoryBlock::id)
-        .field("size", &MemoryBlock::size)
-        .field("allocated", &MemoryBlock::allocated)
-        .field("process_id", &MemoryBlock::process_id);
+} // namespace
 
-    value_object<ProcessRequest>("ProcessRequest")
-        .field("id", &ProcessRequest::id)
-        .field("size", &ProcessRequest::size)
-        .field("allocated", &ProcessRequest::allocated)
-        .field("block_id", &ProcessRequest::block_id);
+// Each request takes the first free block in address order that fits,
+// found by descending the max-size tree: O(log blocks) per request
+AllocationResult MemoryManager::first_fit(std::vector<MemoryBlock> blocks, std::vector<ProcessRequest> processes) {
+    FreeBlockTree free_blocks(blocks);
+    for (auto& p : processes) {
+        int idx = free_blocks.leftmost(p.size);
+        if (idx == -1) continue;
+        free_blocks.take(idx);
+        assign(blocks[idx], p);
+    }
+    return {blocks, processes};
+}
 
-    value_object<AllocationResult>("AllocationResult")
-        .field("blocks", &AllocationResult::blocks)
-        .field("processes", &AllocationResult::processes);
+// Free blocks sorted by (size, index): the smallest fit starts at a
+// lower_bound, and taken entries are skipped through next-free links with
+// path halving, since blocks only ever leave. Equal sizes still go to the
+// lowest index.
+AllocationResult MemoryManager::best_fit(std::vector<MemoryBlock> blocks, std::vector<ProcessRequest> processes) {
+    std::vector<std::pair<int, int>> sorted;
+    for (int i = 0; i < (int)blocks.size(); ++i) {
+        if (!blocks[i].allocated) sorted.push_back({blocks[i].size, i});
+    }
+    std::sort(sorted.begin(), sorted.end());
+    int n = sorted.size();
+    std::vector<int> next_free(n + 1); // n is the "none left" sentinel
+    for (int i = 0; i <= n; ++i) next_free[i] = i;
+    auto find = [&](int i) {
+        while (next_free[i] != i) {
+            next_free[i] = next_free[next_free[i]];
+            i = next_free[i];
+        }
+        return i;
+    };
 
-    register_vector<MemoryBlock>("vector<MemoryBlock>");
-    register_vector<ProcessRequest>("vector<ProcessRequest>");
-    
-    class_<MemoryManager>("MemoryManager")
-        .constructor<>()
-        .function("first_fit", &MemoryManager::first_fit)
-        .function("best_fit", &MemoryManager::best_fit)
-        .function("worst_fit", &MemoryManager::worst_fit);
+    for (auto& p : processes) {
+        int pos = std::lower_bound(sorted.begin(), sorted.end(), std::make_pair(p.size, INT_MIN)) - sorted.begin();
+        pos = find(pos);
+        if (pos == n) continue;
+        next_free[pos] = pos + 1;
+        assign(blocks[sorted[pos].second], p);
+    }
+    return {blocks, processes};
+}
+
+// The largest free block is the tree's root; the leftmost block that large
+// is found the same way first fit finds its block
+AllocationResult MemoryManager::worst_fit(std::vector<MemoryBlock> blocks, std::vector<ProcessRequest> processes) {
+    FreeBlockTree free_blocks(blocks);
+    for (auto& p : processes) {
+        int largest = free_blocks.largest();
+        if (largest == INT_MIN || largest < p.size) continue;
+        int idx = free_blocks.leftmost(largest);
+        free_blocks.take(idx);
+        assign(blocks[idx], p);
+    }
+    return {blocks, processes};
 }
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <climits>
+
+struct MemoryBlock {
+    int id;
+    int size;
+    bool allocated;
+    int process_id; // -1 if free
+};
+
+struct ProcessRequest {
+    int id;
+    int size;
+    bool allocated;
+    int block_id; // -1 if not allocated
+};
+
+struct AllocationResult {
+    std::vector<MemoryBlock> blocks;
+    std::vector<ProcessRequest> processes;
+};
+
+class MemoryManager {
+public:
+    AllocationResult first_fit(std::vector<MemoryBlock> blocks, std::vector<ProcessRequest> processes);
+    AllocationResult best_fit(std::vector<MemoryBlock> blocks, std::vector<ProcessRequest> processes);
+    AllocationResult worst_fit(std::vector<MemoryBlock> blocks, std::vector<ProcessRequest> processes);
+};
@@ -0,0 +1,110 @@
+#include <climits>
+#include <algorithm>
+#include <unordered_map>
+#include "miss_ratio.h"
+
+namespace {
+
+// Turns a stack-distance histogram (index 0 unused) into per-capacity faults
+MissRatioCurve build_curve(const std::vector<long long>& hits_at, int references, int distinct, int max_capacity) {
+    MissRatioCurve curve;
+    curve.references = references;
+    curve.distinct_pages = distinct;
+    curve.faults.resize(max_capacity);
+    curve.miss_ratio.resize(max_capacity);
+    long long hits = 0;
+    for (int c = 1; c <= max_capacity; ++c) {
+        hits += hits_at[c];
+        curve.faults[c - 1] = references - hits;
+        curve.miss_ratio[c - 1] = references ? (double)(references - hits) / references : 0;
+    }
+    return curve;
+}
+
+// Dense page ids, 0.. in order of first reference
+std::vector<int> dense_ids(const std::vector<int>& pages, int& distinct) {
+    std::unordered_map<int, int> id_of;
+    std::vector<int> ids(pages.size());
+    for (size_t i = 0; i < pages.size(); ++i) {
+        ids[i] = id_of.emplace(pages[i], (int)id_of.size()).first->second;
+    }
+    distinct = id_of.size();
+    return ids;
+}
+
+} // namespace
+
+MissRatioCurve lru_miss_ratio_curve(const std::vector<int>& pages, int max_capacity) {
+    max_capacity = std::max(max_capacity, 0);
+    int n = pages.size();
+    int distinct;
+    std::vector<int> ids = dense_ids(pages, distinct);
+
+    // tree marks the time of each page's latest reference
+    std::vector<int> tree(n + 1, 0);
+    auto add = [&](int i, int delta) {
+        for (++i; i <= n; i += i & -i) tree[i] += delta;
+    };
+    auto prefix = [&](int i) { // Marks at times < i
+        int sum = 0;
+        for (; i > 0; i -= i & -i) sum += tree[i];
+        return sum;
+    };
+
+    std::vector<int> last(distinct, -1);
+    std::vector<long long> hits_at(max_capacity + 1, 0);
+    int marked = 0;
+    for (int i = 0; i < n; ++i) {
+        int id = ids[i];
+        if (last[id] != -1) {
+            // Distinct pages referenced after the previous use, plus this one
+            int distance = marked - prefix(last[id] + 1) + 1;
+            if (distance <= max_capacity) hits_at[distance]++;
+            add(last[id], -1);
+            marked--;
+        }
+        add(i, 1);
+        marked++;
+        last[id] = i;
+    }
+    return build_curve(hits_at, n, distinct, max_capacity);
+}
+
+MissRatioCurve opt_miss_ratio_curve(const std::vector<int>& pages, int max_capacity) {
+    max_capacity = std::max(max_capacity, 0);
+    int n = pages.size();
+    int distinct;
+    std::vector<int> ids = dense_ids(pages, distinct);
+
+    std::vector<int> next_use(n);
+    std::vector<int> upcoming(distinct, INT_MAX);
+    for (int i = n - 1; i >= 0; --i) {
+        next_use[i] = upcoming[ids[i]];
+        upcoming[ids[i]] = i;
+    }
+
+    // stack[0..] holds page ids, the contents of an OPT memory of size c
+    // being stack[0, c). next_of is each page's next use as of now.
+    std::vector<int> stack;
+    stack.reserve(max_capacity);
+    std::vector<int> next_of(distinct, INT_MAX);
+    std::vector<long long> hits_at(max_capacity + 1, 0);
+    for (int i = 0; i < n; ++i) {
+        int id = ids[i];
+        next_of[id] = next_use[i];
+        int depth = 0;
+        while (depth < (int)stack.size() && stack[depth] != id) depth++;
+        if (depth < (int)stack.size()) hits_at[depth + 1]++;
+        if (max_capacity == 0) continue;
+
+        // The referenced page goes on top. Going down, each level keeps the
+        // sooner-needed of its page and the one pushed out from above.
+        int carry = id;
+        for (int level = 0; level < depth; ++level) {
+            if (level == 0 || next_of[carry] < next_of[stack[level]]) std::swap(carry, stack[level]);
+        }
+        if (depth < (int)stack.size()) stack[depth] = carry;
+        else if ((int)stack.size() < max_capacity) stack.push_back(carry);
+    }
+    return build_curve(hits_at, n, distinct, max_capacity);
+}
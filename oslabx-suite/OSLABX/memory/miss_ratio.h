@@ -0,0 +1,23 @@
+#pragma once
+
+#include <vector>
+
+// Fault counts of one policy for every capacity 1..max_capacity
+struct MissRatioCurve {
+    int references;
+    int distinct_pages;          // Cold misses, paid at every capacity
+    std::vector<int> faults;     // faults[c - 1] for capacity c
+    std::vector<double> miss_ratio;
+};
+
+// Mattson stack-distance analysis: LRU and OPT are stack algorithms, so a
+// reference hits at capacity c exactly when its stack distance is <= c and
+// one pass yields the whole curve.
+
+// LRU: the distance is the number of distinct pages touched since the last
+// reference, counted with a Fenwick tree over reference times. O(n log n).
+MissRatioCurve lru_miss_ratio_curve(const std::vector<int>& pages, int max_capacity);
+
+// OPT: a priority stack ordered by next use, truncated at max_capacity.
+// O(n * max_capacity).
+MissRatioCurve opt_miss_ratio_curve(const std::vector<int>& pages, int max_capacity);
@@ -0,0 +1,582 @@
+#include <algorithm>
+#include <climits>
+#include <utility>
+#include "page_engines.h"
+
+FifoEngine::FifoEngine(int capacity) : capacity(capacity) {
+    if (capacity > 0) {
+        slot_of.reserve(capacity);
+        page_at.reserve(capacity);
+    }
+}
+
+PageAccess FifoEngine::reference(int page) {
+    auto it = slot_of.find(page);
+    if (it != slot_of.end()) return {false, it->second};
+    if (capacity <= 0) return {true, -1};
+
+    int slot;
+    if ((int)page_at.size() < capacity) {
+        slot = page_at.size();
+        page_at.push_back(page);
+    } else {
+        slot = oldest;
+        oldest = (oldest + 1) % capacity;
+        slot_of.erase(page_at[slot]);
+        page_at[slot] = page;
+    }
+    slot_of.emplace(page, slot);
+    return {true, slot};
+}
+
+LruEngine::LruEngine(int capacity) : capacity(capacity) {
+    if (capacity > 0) {
+        slot_of.reserve(capacity);
+        page_at.reserve(capacity);
+        prev.reserve(capacity);
+        next.reserve(capacity);
+    }
+}
+
+void LruEngine::unlink(int slot) {
+    if (prev[slot] != -1) next[prev[slot]] = next[slot];
+    else head = next[slot];
+    if (next[slot] != -1) prev[next[slot]] = prev[slot];
+    else tail = prev[slot];
+}
+
+void LruEngine::push_front(int slot) {
+    prev[slot] = -1;
+    next[slot] = head;
+    if (head != -1) prev[head] = slot;
+    else tail = slot;
+    head = slot;
+}
+
+PageAccess LruEngine::reference(int page) {
+    auto it = slot_of.find(page);
+    if (it != slot_of.end()) {
+        int slot = it->second;
+        if (slot != head) {
+            unlink(slot);
+            push_front(slot);
+        }
+        return {false, slot};
+    }
+    if (capacity <= 0) return {true, -1};
+
+    int slot;
+    if ((int)page_at.size() < capacity) {
+        slot = page_at.size();
+        page_at.push_back(page);
+        prev.push_back(-1);
+        next.push_back(-1);
+    } else {
+        // Evict the least recently used page and take over its slot
+        slot = tail;
+        unlink(slot);
+        slot_of.erase(page_at[slot]);
+        page_at[slot] = page;
+    }
+    slot_of.emplace(page, slot);
+    push_front(slot);
+    return {true, slot};
+}
+
+OptEngine::OptEngine(const std::vector<int>& pages, int capacity) : capacity(capacity) {
+    int n = pages.size();
+    ref_id.resize(n);
+    next_use.resize(n);
+    std::unordered_map<int, std::pair<int, int>> seen; // page -> (id, next reference)
+    for (int i = n - 1; i >= 0; --i) {
+        auto it = seen.find(pages[i]);
+        if (it == seen.end()) {
+            int id = seen.size();
+            it = seen.emplace(pages[i], std::make_pair(id, INT_MAX)).first;
+        }
+        ref_id[i] = it->second.first;
+        next_use[i] = it->second.second;
+        it->second.second = i;
+    }
+    slot_of.assign(seen.size(), -1);
+}
+
+// True when slot a's page should be evicted before slot b's
+bool OptEngine::evict_first(int a, int b) const {
+    return key[a] != key[b] ? key[a] > key[b] : a < b;
+}
+
+void OptEngine::sift_up(int pos) {
+    int slot = heap[pos];
+    while (pos > 0) {
+        int parent = (pos - 1) / 2;
+        if (!evict_first(slot, heap[parent])) break;
+        heap[pos] = heap[parent];
+        heap_pos[heap[pos]] = pos;
+        pos = parent;
+    }
+    heap[pos] = slot;
+    heap_pos[slot] = pos;
+}
+
+void OptEngine::sift_down(int pos) {
+    int slot = heap[pos];
+    int size = heap.size();
+    while (true) {
+        int child = 2 * pos + 1;
+        if (child >= size) break;
+        if (child + 1 < size && evict_first(heap[child + 1], heap[child])) child++;
+        if (!evict_first(heap[child], slot)) break;
+        heap[pos] = heap[child];
+        heap_pos[heap[pos]] = pos;
+        pos = child;
+    }
+    heap[pos] = slot;
+    heap_pos[slot] = pos;
+}
+
+PageAccess OptEngine::reference(int) {
+    int i = position++;
+    int id = ref_id[i];
+    int slot = slot_of[id];
+    if (slot != -1) {
+        // The next use only moves later, towards the top
+        key[slot] = next_use[i];
+        sift_up(heap_pos[slot]);
+        return {false, slot};
+    }
+    if (capacity <= 0) return {true, -1};
+
+    if ((int)id_at.size() < capacity) {
+        slot = id_at.size();
+        id_at.push_back(id);
+        key.push_back(next_use[i]);
+        heap.push_back(slot);
+        heap_pos.push_back(heap.size() - 1);
+        sift_up(heap.size() - 1);
+    } else {
+        slot = heap[0];
+        slot_of[id_at[slot]] = -1;
+        id_at[slot] = id;
+        key[slot] = next_use[i];
+        sift_down(0);
+    }
+    slot_of[id] = slot;
+    return {true, slot};
+}
+
+FrequencyEngine::FrequencyEngine(int capacity, bool most_frequent)
+    : capacity(capacity), most_frequent(most_frequent) {
+    if (capacity > 0) slot_of.reserve(capacity);
+}
+
+// Links a new, empty bucket after `after` (-1: at the low end)
+int FrequencyEngine::add_bucket(int count, int after) {
+    int b;
+    if (free_buckets.empty()) {
+        b = buckets.size();
+        buckets.push_back({});
+    } else {
+        b = free_buckets.back();
+        free_buckets.pop_back();
+    }
+    int before = after == -1 ? lowest : buckets[after].next;
+    buckets[b] = {count, after, before, -1, -1};
+    if (after != -1) buckets[after].next = b;
+    else lowest = b;
+    if (before != -1) buckets[before].prev = b;
+    else highest = b;
+    return b;
+}
+
+void FrequencyEngine::attach(int slot, int b) {
+    bucket_of[slot] = b;
+    prev[slot] = buckets[b].last;
+    next[slot] = -1;
+    if (buckets[b].last != -1) next[buckets[b].last] = slot;
+    else buckets[b].first = slot;
+    buckets[b].last = slot;
+}
+
+// Unlinks a slot, dropping its bucket when that leaves it empty
+void FrequencyEngine::detach(int slot) {
+    Bucket& bucket = buckets[bucket_of[slot]];
+    if (prev[slot] != -1) next[prev[slot]] = next[slot];
+    else bucket.first = next[slot];
+    if (next[slot] != -1) prev[next[slot]] = prev[slot];
+    else bucket.last = prev[slot];
+    if (bucket.first != -1) return;
+
+    if (bucket.prev != -1) buckets[bucket.prev].next = bucket.next;
+    else lowest = bucket.next;
+    if (bucket.next != -1) buckets[bucket.next].prev = bucket.prev;
+    else highest = bucket.prev;
+    free_buckets.push_back(bucket_of[slot]);
+}
+
+PageAccess FrequencyEngine::reference(int page) {
+    auto it = slot_of.find(page);
+    if (it != slot_of.end()) {
+        int slot = it->second;
+        int b = bucket_of[slot];
+        int up = buckets[b].next;
+        if (up == -1 || buckets[up].count != buckets[b].count + 1) up = add_bucket(buckets[b].count + 1, b);
+        detach(slot);
+        attach(slot, up);
+        return {false, slot};
+    }
+    if (capacity <= 0) return {true, -1};
+
+    int slot;
+    if ((int)page_at.size() < capacity) {
+        slot = page_at.size();
+        page_at.push_back(page);
+        bucket_of.push_back(-1);
+        prev.push_back(-1);
+        next.push_back(-1);
+    } else {
+        slot = buckets[most_frequent ? highest : lowest].first;
+        detach(slot);
+        slot_of.erase(page_at[slot]);
+        page_at[slot] = page;
+    }
+    slot_of.emplace(page, slot);
+    int ones = lowest != -1 && buckets[lowest].count == 1 ? lowest : add_bucket(1, -1);
+    attach(slot, ones);
+    return {true, slot};
+}
+
+ClockEngine::ClockEngine(int capacity) : capacity(capacity) {
+    if (capacity > 0) slot_of.reserve(capacity);
+}
+
+PageAccess ClockEngine::reference(int page) {
+    auto it = slot_of.find(page);
+    if (it != slot_of.end()) {
+        referenced[it->second] = 1;
+        return {false, it->second};
+    }
+    if (capacity <= 0) return {true, -1};
+
+    int slot;
+    if ((int)page_at.size() < capacity) {
+        slot = page_at.size();
+        page_at.push_back(page);
+        referenced.push_back(1);
+    } else {
+        // Give every referenced page a second chance on the way round
+        while (referenced[hand]) {
+            referenced[hand] = 0;
+            hand = (hand + 1) % capacity;
+        }
+        slot = hand;
+        hand = (hand + 1) % capacity;
+        slot_of.erase(page_at[slot]);
+        page_at[slot] = page;
+        referenced[slot] = 1;
+    }
+    slot_of.emplace(page, slot);
+    return {true, slot};
+}
+
+void LinkList::push_front(std::vector<Link>& links, int node) {
+    links[node] = {-1, front};
+    if (front != -1) links[front].prev = node;
+    else back = node;
+    front = node;
+    size++;
+}
+
+void LinkList::remove(std::vector<Link>& links, int node) {
+    if (links[node].prev != -1) links[links[node].prev].next = links[node].next;
+    else front = links[node].next;
+    if (links[node].next != -1) links[links[node].next].prev = links[node].prev;
+    else back = links[node].prev;
+    size--;
+}
+
+int PageNodes::find(int p) const {
+    auto it = node_of.find(p);
+    return it == node_of.end() ? -1 : it->second;
+}
+
+int PageNodes::add(int p) {
+    int node;
+    if (free_nodes.empty()) {
+        node = page.size();
+        page.push_back(p);
+        slot.push_back(-1);
+        list.push_back(-1);
+        links.push_back({});
+    } else {
+        node = free_nodes.back();
+        free_nodes.pop_back();
+        page[node] = p;
+        slot[node] = -1;
+        list[node] = -1;
+    }
+    node_of.emplace(p, node);
+    return node;
+}
+
+void PageNodes::forget(int node) {
+    node_of.erase(page[node]);
+    free_nodes.push_back(node);
+}
+
+ArcEngine::ArcEngine(int capacity) : capacity(capacity) {}
+
+void ArcEngine::move_to(int node, int list) {
+    if (nodes.list[node] != -1) lists[nodes.list[node]].remove(nodes.links, node);
+    lists[list].push_front(nodes.links, node);
+    nodes.list[node] = list;
+}
+
+void ArcEngine::drop(int node) {
+    lists[nodes.list[node]].remove(nodes.links, node);
+    nodes.forget(node);
+}
+
+// Evicts the LRU page of T1 or T2 into its history list and returns its slot
+int ArcEngine::replace(bool hit_in_b2) {
+    int t1 = lists[T1].size;
+    int victim;
+    if (t1 > 0 && ((hit_in_b2 && t1 == target) || t1 > target || lists[T2].size == 0)) {
+        victim = lists[T1].back;
+        move_to(victim, B1);
+    } else {
+        victim = lists[T2].back;
+        move_to(victim, B2);
+    }
+    return nodes.slot[victim];
+}
+
+PageAccess ArcEngine::reference(int page) {
+    int node = nodes.find(page);
+    if (node != -1 && (nodes.list[node] == T1 || nodes.list[node] == T2)) {
+        move_to(node, T2);
+        return {false, nodes.slot[node]};
+    }
+    if (capacity <= 0) return {true, -1};
+
+    int slot;
+    if (node != -1 && nodes.list[node] == B1) {
+        target = std::min(capacity, target + std::max(lists[B2].size / lists[B1].size, 1));
+        slot = replace(false);
+        move_to(node, T2);
+    } else if (node != -1) {
+        target = std::max(0, target - std::max(lists[B1].size / lists[B2].size, 1));
+        slot = replace(true);
+        move_to(node, T2);
+    } else {
+        int l1 = lists[T1].size + lists[B1].size;
+        int total = l1 + lists[T2].size + lists[B2].size;
+        if (l1 == capacity) {
+            if (lists[T1].size < capacity) {
+                drop(lists[B1].back);
+                slot = replace(false);
+            } else {
+                // T1 fills the cache: its LRU page goes without a history entry
+                int victim = lists[T1].back;
+                slot = nodes.slot[victim];
+                drop(victim);
+            }
+        } else if (total >= capacity) {
+            if (total == 2 * capacity) drop(lists[B2].back);
+            slot = replace(false);
+        } else {
+            slot = filled++;
+        }
+        node = nodes.add(page);
+        move_to(node, T1);
+    }
+    nodes.slot[node] = slot;
+    return {true, slot};
+}
+
+TwoQueueEngine::TwoQueueEngine(int capacity)
+    : capacity(capacity), in_limit(std::max(1, capacity / 4)), out_limit(std::max(1, capacity / 2)) {}
+
+void TwoQueueEngine::move_to(int node, int list) {
+    unlink(node);
+    lists[list].push_front(nodes.links, node);
+    nodes.list[node] = list;
+}
+
+void TwoQueueEngine::unlink(int node) {
+    if (nodes.list[node] != -1) lists[nodes.list[node]].remove(nodes.links, node);
+    nodes.list[node] = -1;
+}
+
+// Frees a frame: A1in's oldest page while A1in is over its share (or Am is
+// empty), remembering it in A1out; otherwise Am's least recently used page
+int TwoQueueEngine::reclaim() {
+    if (filled < capacity) return filled++;
+    int victim;
+    if (lists[A1IN].size > in_limit || lists[AM].size == 0) {
+        victim = lists[A1IN].back;
+        move_to(victim, A1OUT);
+        if (lists[A1OUT].size > out_limit) {
+            int oldest = lists[A1OUT].back;
+            unlink(oldest);
+            nodes.forget(oldest);
+        }
+    } else {
+        victim = lists[AM].back;
+        unlink(victim);
+        nodes.forget(victim);
+    }
+    return nodes.slot[victim];
+}
+
+PageAccess TwoQueueEngine::reference(int page) {
+    int node = nodes.find(page);
+    if (node != -1 && nodes.list[node] == AM) {
+        move_to(node, AM);
+        return {false, nodes.slot[node]};
+    }
+    if (node != -1 && nodes.list[node] == A1IN) return {false, nodes.slot[node]};
+    if (capacity <= 0) return {true, -1};
+
+    // Take a remembered page off A1out first so reclaiming can't drop it
+    if (node != -1) unlink(node);
+    int slot = reclaim();
+    if (node != -1) {
+        move_to(node, AM);
+    } else {
+        node = nodes.add(page);
+        move_to(node, A1IN);
+    }
+    nodes.slot[node] = slot;
+    return {true, slot};
+}
+
+LirsEngine::LirsEngine(int capacity)
+    : capacity(capacity), lir_limit(std::max(0, capacity - std::max(1, capacity / 100))) {}
+
+int LirsEngine::add(int page) {
+    int node = nodes.add(page);
+    if (node >= (int)stack_links.size()) {
+        stack_links.resize(node + 1);
+        in_stack.resize(node + 1, 0);
+    }
+    in_stack[node] = 0;
+    return node;
+}
+
+void LirsEngine::forget(int node) {
+    if (in_stack[node]) leave_stack(node);
+    nodes.forget(node);
+}
+
+void LirsEngine::to_stack_top(int node) {
+    if (in_stack[node]) stack.remove(stack_links, node);
+    stack.push_front(stack_links, node);
+    in_stack[node] = 1;
+}
+
+void LirsEngine::leave_stack(int node) {
+    stack.remove(stack_links, node);
+    in_stack[node] = 0;
+}
+
+// The LIR page at the bottom of S becomes a resident HIR page
+void LirsEngine::demote_bottom() {
+    int bottom = stack.back;
+    leave_stack(bottom);
+    nodes.list[bottom] = HIR;
+    lir_count--;
+    queue.push_front(nodes.links, bottom);
+    prune();
+}
+
+// Pops HIR entries off the bottom of S until an LIR page is there
+void LirsEngine::prune() {
+    while (stack.back != -1 && nodes.list[stack.back] != LIR) {
+        int node = stack.back;
+        leave_stack(node);
+        if (nodes.list[node] == GHOST) {
+            ghosts.remove(nodes.links, node);
+            nodes.forget(node);
+        }
+    }
+}
+
+PageAccess LirsEngine::reference(int page) {
+    int node = nodes.find(page);
+    if (node != -1 && nodes.list[node] == LIR) {
+        bool was_bottom = stack.back == node;
+        to_stack_top(node);
+        if (was_bottom) prune();
+        return {false, nodes.slot[node]};
+    }
+    if (node != -1 && nodes.list[node] == HIR) {
+        queue.remove(nodes.links, node);
+        if (in_stack[node] && lir_limit > 0) {
+            // Reused within the LIR pages' recency: it becomes LIR
+            to_stack_top(node);
+            nodes.list[node] = LIR;
+            lir_count++;
+            demote_bottom();
+        } else {
+            to_stack_top(node);
+            queue.push_front(nodes.links, node);
+        }
+        return {false, nodes.slot[node]};
+    }
+    if (capacity <= 0) return {true, -1};
+
+    int slot;
+    if (filled < capacity) {
+        // Warm-up: LIR pages first, then HIR
+        slot = filled++;
+        node = add(page);
+        to_stack_top(node);
+        if (lir_count < lir_limit) {
+            nodes.list[node] = LIR;
+            lir_count++;
+        } else {
+            nodes.list[node] = HIR;
+            queue.push_front(nodes.links, node);
+        }
+        nodes.slot[node] = slot;
+        return {true, slot};
+    }
+
+    // The oldest resident HIR page makes room; S may keep it as a ghost
+    int victim = queue.back;
+    queue.remove(nodes.links, victim);
+    slot = nodes.slot[victim];
+    if (in_stack[victim]) {
+        nodes.list[victim] = GHOST;
+        ghosts.push_front(nodes.links, victim);
+    } else {
+        nodes.forget(victim);
+    }
+
+    if (node != -1 && lir_limit > 0) {
+        // A ghost still in S: its reuse distance beats the bottom LIR page's
+        ghosts.remove(nodes.links, node);
+        to_stack_top(node);
+        nodes.list[node] = LIR;
+        lir_count++;
+        demote_bottom();
+    } else {
+        if (node != -1) {
+            ghosts.remove(nodes.links, node);
+        } else {
+            node = add(page);
+        }
+        to_stack_top(node);
+        nodes.list[node] = HIR;
+        queue.push_front(nodes.links, node);
+    }
+    nodes.slot[node] = slot;
+
+    while (ghosts.size > capacity) {
+        int oldest = ghosts.back;
+        ghosts.remove(nodes.links, oldest);
+        forget(oldest);
+    }
+    return {true, slot};
+}
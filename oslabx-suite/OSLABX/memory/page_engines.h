@@ -0,0 +1,242 @@
+#pragma once
+
+#include <vector>
+#include <unordered_map>
+
+// Outcome of one reference. On a fault the page now sits in `slot`: either a
+// fresh slot (the next one in fill order) or the slot of the evicted page.
+// slot is -1 when there are no frames at all.
+struct PageAccess {
+    bool fault;
+    int slot;
+};
+
+// Runtime ids for the replacement policies
+enum PagePolicy {
+    PAGE_FIFO = 0,
+    PAGE_LRU = 1,
+    PAGE_OPTIMAL = 2,
+    PAGE_LFU = 3,
+    PAGE_MFU = 4,
+    PAGE_CLOCK = 5,
+    PAGE_ARC = 6,
+    PAGE_TWO_QUEUE = 7,
+    PAGE_LIRS = 8
+};
+
+// Replacement engines.
+//
+// An engine tracks which page sits in each of `capacity` frame slots and
+// answers reference(page) with a PageAccess. Slots fill in order 0, 1, ...
+// and a victim's slot is reused for the incoming page, which is exactly the
+// frame layout the PageStep output shows.
+
+// First In First Out: the oldest load is always the next slot in round-robin
+// order, so only the page index needs hashing
+class FifoEngine {
+public:
+    explicit FifoEngine(int capacity);
+    PageAccess reference(int page);
+
+private:
+    int capacity;
+    int oldest = 0; // Slot to overwrite next once all are filled
+    std::unordered_map<int, int> slot_of;
+    std::vector<int> page_at;
+};
+
+// Least Recently Used in O(1) per reference: a hash index from page to slot,
+// and the slots threaded into a doubly linked recency list
+class LruEngine {
+public:
+    explicit LruEngine(int capacity);
+    PageAccess reference(int page);
+
+private:
+    void unlink(int slot);
+    void push_front(int slot);
+
+    int capacity;
+    std::unordered_map<int, int> slot_of;
+    std::vector<int> page_at;
+    std::vector<int> prev, next; // Recency list: head is most recent, tail is the victim
+    int head = -1, tail = -1;
+};
+
+// Belady's optimal replacement: evict the resident page whose next use is
+// farthest away. Pages never used again go first, lowest slot first, as in
+// the original frame scan. One backward pass precomputes every reference's
+// next use; the resident slots sit in an indexed max-heap keyed on it, so a
+// reference costs O(log capacity).
+// Offline: reference() must be fed the constructor's trace, in order.
+class OptEngine {
+public:
+    OptEngine(const std::vector<int>& pages, int capacity);
+    PageAccess reference(int page);
+
+private:
+    bool evict_first(int a, int b) const;
+    void sift_up(int pos);
+    void sift_down(int pos);
+
+    int capacity;
+    int position = 0;
+    std::vector<int> ref_id;   // Dense page id of each reference
+    std::vector<int> next_use; // Next reference of the same page, INT_MAX if none
+    std::vector<int> slot_of;  // Per page id, -1 when not resident
+    std::vector<int> id_at;    // Page id per slot
+    std::vector<int> key;      // Next use of each slot's page
+    std::vector<int> heap;     // Slots, best victim on top
+    std::vector<int> heap_pos; // Index of each slot in heap
+};
+
+// LFU / MFU with O(1) update and eviction. Resident pages hang off a list of
+// frequency buckets kept in increasing order; a hit moves the page into the
+// next bucket up. A page's count is the number of references since it was
+// loaded, so it restarts at 1 after an eviction. Ties go to the oldest page
+// in the bucket, the one that reached that count first.
+class FrequencyEngine {
+public:
+    // most_frequent: evict from the highest bucket (MFU) instead of the lowest (LFU)
+    FrequencyEngine(int capacity, bool most_frequent);
+    PageAccess reference(int page);
+
+private:
+    struct Bucket {
+        int count;
+        int prev, next;  // Neighbouring buckets, lower and higher count
+        int first, last; // Slots, oldest first
+    };
+
+    int add_bucket(int count, int after);
+    void attach(int slot, int bucket);
+    void detach(int slot);
+
+    int capacity;
+    bool most_frequent;
+    std::unordered_map<int, int> slot_of;
+    std::vector<int> page_at;
+    std::vector<int> bucket_of, prev, next; // Per slot: its bucket and neighbours within it
+    std::vector<Bucket> buckets;
+    std::vector<int> free_buckets;
+    int lowest = -1, highest = -1;
+};
+
+// CLOCK, i.e. second chance: slots form a ring with a reference bit each,
+// set on every reference including the load. The hand clears set bits as it
+// passes and stops at the first clear one. Amortised O(1).
+class ClockEngine {
+public:
+    explicit ClockEngine(int capacity);
+    PageAccess reference(int page);
+
+private:
+    int capacity;
+    int hand = 0;
+    std::unordered_map<int, int> slot_of;
+    std::vector<int> page_at;
+    std::vector<char> referenced;
+};
+
+// The multi-list policies below track pages in reusable nodes threaded onto
+// intrusive lists, so every list operation is O(1).
+
+struct Link {
+    int prev = -1, next = -1;
+};
+
+// Doubly linked list through a caller-owned Link array; front is the most
+// recent end, back the oldest
+struct LinkList {
+    int front = -1, back = -1, size = 0;
+
+    void push_front(std::vector<Link>& links, int node);
+    void remove(std::vector<Link>& links, int node);
+};
+
+// Pages an engine remembers, resident or only as history
+struct PageNodes {
+    std::unordered_map<int, int> node_of;
+    std::vector<int> page, slot, list; // list: engine-defined, -1 for none
+    std::vector<Link> links;
+    std::vector<int> free_nodes;
+
+    int find(int p) const;
+    int add(int p);
+    void forget(int node);
+};
+
+// Adaptive Replacement Cache (Megiddo & Modha). T1 holds pages seen once
+// recently, T2 pages seen at least twice; B1 and B2 remember as many evicted
+// pages again, and hits on them move the T1/T2 split target.
+class ArcEngine {
+public:
+    explicit ArcEngine(int capacity);
+    PageAccess reference(int page);
+
+private:
+    enum { T1, T2, B1, B2 };
+
+    void move_to(int node, int list);
+    void drop(int node);
+    int replace(bool hit_in_b2);
+
+    int capacity;
+    int target = 0; // Preferred size of T1
+    int filled = 0;
+    PageNodes nodes;
+    LinkList lists[4];
+};
+
+// 2Q (Johnson & Shasha), full version. New pages enter the FIFO A1in, which
+// holds a quarter of the frames; pages evicted from it are remembered in
+// A1out (half the frame count), and only a miss that hits A1out is promoted
+// to the LRU main queue Am. A hit in A1in changes nothing.
+class TwoQueueEngine {
+public:
+    explicit TwoQueueEngine(int capacity);
+    PageAccess reference(int page);
+
+private:
+    enum { AM, A1IN, A1OUT };
+
+    void move_to(int node, int list);
+    void unlink(int node);
+    int reclaim();
+
+    int capacity;
+    int in_limit, out_limit;
+    int filled = 0;
+    PageNodes nodes;
+    LinkList lists[3];
+};
+
+// LIRS (Jiang & Zhang). Pages with a short reuse distance (LIR) keep 99% of
+// the frames; the rest hold HIR pages in the FIFO queue Q, which is where
+// every victim comes from. The recency stack S decides promotions and is
+// pruned so an LIR page is always at its bottom. Non-resident HIR entries
+// kept in S are capped at `capacity`, oldest dropped first.
+class LirsEngine {
+public:
+    explicit LirsEngine(int capacity);
+    PageAccess reference(int page);
+
+private:
+    enum { LIR, HIR, GHOST }; // Node states; HIR means resident HIR
+
+    int add(int page);
+    void forget(int node);
+    void to_stack_top(int node);
+    void leave_stack(int node);
+    void demote_bottom();
+    void prune();
+
+    int capacity;
+    int lir_limit;
+    int lir_count = 0;
+    int filled = 0;
+    PageNodes nodes;                // list holds the state, links the Q / ghost list
+    std::vector<Link> stack_links;
+    std::vector<char> in_stack;
+    LinkList stack, queue, ghosts;  // queue: resident HIR pages; ghosts: non-resident, in S
+};
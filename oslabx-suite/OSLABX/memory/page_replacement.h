@@ -0,0 +1,164 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <unordered_set>
+#include <deque>
+#include <algorithm>
+#include <climits>
+#include <map>
+#include "page_engines.h"
+#include "miss_ratio.h"
+
+struct PageStep {
+    int page;
+    int step;
+    std::vector<int> frames;
+    bool fault;
+};
+
+// One reference in a PageHistory
+struct PageEvent {
+    int page;
+    bool fault;
+    int slot;     // Slot holding the page afterwards, -1 with no frames
+    bool evicted; // A fault that replaced another page
+    int evicted_page;
+};
+
+// Compact alternative to a PageStep vector: one small record per reference,
+// plus a copy of the frames every `interval` steps. frames_at() rebuilds any
+// step from the keyframe before it, so memory is O(n + n / interval * frames)
+// and a lookup replays at most interval - 1 events.
+class PageHistory {
+public:
+    int size() const { return events.size(); }
+    int faults() const { return fault_count; }
+    // A step outside [0, size()) gives an empty record: page -1, no frames
+    PageEvent event(int step) const { return in_range(step) ? events[step] : PageEvent{-1, false, -1, false, -1}; }
+    // Frame contents right after `step`, in slot order
+    std::vector<int> frames_at(int step) const;
+    // Same record as the full-snapshot output gives for `step`
+    PageStep step_at(int step) const;
+
+    template <class Engine>
+    friend PageHistory record_history(const std::vector<int>& pages, Engine& engine, int interval);
+
+private:
+    bool in_range(int step) const { return step >= 0 && step < (int)events.size(); }
+
+    std::vector<PageEvent> events;
+    std::vector<std::vector<int>> keyframes; // keyframes[k]: frames before step k * interval
+    int interval = 1;
+    int fault_count = 0;
+};
+
+// Applies one reference to a frames vector laid out by slot
+inline void apply_access(std::vector<int>& frames, int page, const PageAccess& a) {
+    if (!a.fault || a.slot < 0) return;
+    if (a.slot == (int)frames.size()) frames.push_back(page);
+    else frames[a.slot] = page;
+}
+
+template <class Engine>
+PageHistory record_history(const std::vector<int>& pages, Engine& engine, int interval) {
+    PageHistory history;
+    history.interval = std::max(interval, 1);
+    history.events.reserve(pages.size());
+    std::vector<int> frames;
+    for (int i = 0; i < (int)pages.size(); ++i) {
+        if (i % history.interval == 0) history.keyframes.push_back(frames);
+        int page = pages[i];
+        PageAccess a = engine.reference(page);
+        bool evicted = a.fault && a.slot >= 0 && a.slot < (int)frames.size();
+        history.events.push_back({page, a.fault, a.slot, evicted, evicted ? frames[a.slot] : -1});
+        history.fault_count += a.fault;
+        apply_access(frames, page, a);
+    }
+    return history;
+}
+
+// Replays pages through an engine, snapshotting the frames after every reference
+template <class Engine>
+std::vector<PageStep> record_steps(const std::vector<int>& pages, Engine& engine) {
+    std::vector<PageStep> steps;
+    steps.reserve(pages.size());
+    std::vector<int> frames;
+    for (int i = 0; i < (int)pages.size(); ++i) {
+        int page = pages[i];
+        PageAccess a = engine.reference(page);
+        apply_access(frames, page, a);
+        steps.push_back({page, i, frames, a.fault});
+    }
+    return steps;
+}
+
+// Same replay without the history, for traces too long to snapshot
+template <class Engine>
+long long count_faults(const std::vector<int>& pages, Engine& engine) {
+    long long faults = 0;
+    for (int page : pages) faults += engine.reference(page).fault;
+    return faults;
+}
+
+// Builds the engine for a PagePolicy id and hands it to fn; unknown ids use
+// FIFO. Online policies only: returns false for PAGE_OPTIMAL, which needs the
+// whole trace up front.
+template <class Fn>
+bool with_online_engine(int policy, int capacity, Fn&& fn) {
+    switch (policy) {
+        case PAGE_OPTIMAL: return false;
+        case PAGE_LRU: { LruEngine e(capacity); fn(e); break; }
+        case PAGE_LFU: { FrequencyEngine e(capacity, false); fn(e); break; }
+        case PAGE_MFU: { FrequencyEngine e(capacity, true); fn(e); break; }
+        case PAGE_CLOCK: { ClockEngine e(capacity); fn(e); break; }
+        case PAGE_ARC: { ArcEngine e(capacity); fn(e); break; }
+        case PAGE_TWO_QUEUE: { TwoQueueEngine e(capacity); fn(e); break; }
+        case PAGE_LIRS: { LirsEngine e(capacity); fn(e); break; }
+        default: { FifoEngine e(capacity); fn(e); break; }
+    }
+    return true;
+}
+
+// Same for any policy, given the trace
+template <class Fn>
+void with_engine(int policy, const std::vector<int>& pages, int capacity, Fn&& fn) {
+    if (policy == PAGE_OPTIMAL) {
+        OptEngine e(pages, capacity);
+        fn(e);
+    } else {
+        with_online_engine(policy, capacity, fn);
+    }
+}
+
+class PageReplacement {
+public:
+    // Full snapshot of the frames after every reference: O(n * capacity)
+    std::vector<PageStep> fifo(std::vector<int> pages, int capacity);
+    std::vector<PageStep> lru(std::vector<int> pages, int capacity);
+    std::vector<PageStep> optimal(std::vector<int> pages, int capacity);
+    // A page's count restarts when it is evicted; ties evict the page that
+    // reached its count first (see FrequencyEngine)
+    std::vector<PageStep> lfu(std::vector<int> pages, int capacity);
+    std::vector<PageStep> mfu(std::vector<int> pages, int capacity);
+    std::vector<PageStep> clock(std::vector<int> pages, int capacity);
+    std::vector<PageStep> arc(std::vector<int> pages, int capacity);
+    std::vector<PageStep> two_queue(std::vector<int> pages, int capacity);
+    std::vector<PageStep> lirs(std::vector<int> pages, int capacity);
+
+    // Fault counts only, without the per-step snapshots
+    int lru_faults(std::vector<int> pages, int capacity);
+    int optimal_faults(std::vector<int> pages, int capacity);
+    int lfu_faults(std::vector<int> pages, int capacity);
+    int mfu_faults(std::vector<int> pages, int capacity);
+    // Any PagePolicy
+    int faults(std::vector<int> pages, int capacity, int policy);
+
+    // Fault counts for every capacity 1..max_capacity in one pass (see miss_ratio.h)
+    MissRatioCurve lru_curve(std::vector<int> pages, int max_capacity);
+    MissRatioCurve optimal_curve(std::vector<int> pages, int max_capacity);
+
+    // Compact history for any PagePolicy; keyframe_interval <= 0 picks
+    // max(64, capacity), which keeps keyframes within O(n) memory
+    PageHistory history(std::vector<int> pages, int capacity, int policy, int keyframe_interval);
+};
@@ -0,0 +1,128 @@
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "page_trace.h"
+#include "page_replacement.h"
+
+namespace {
+
+const char trace_magic[8] = {'O', 'S', 'L', 'X', 'P', 'G', 'T', '1'};
+const size_t header_bytes = 16;
+
+template <class Engine>
+void replay(const int32_t* pages, long long n, Engine& engine, int capacity, PageTraceSummary& s) {
+    long long loaded = 0; // Slots filled so far; later faults evict
+    long long window_faults = 0;
+    for (long long i = 0; i < n; ++i) {
+        PageAccess a = engine.reference(pages[i]);
+        if (a.fault) {
+            s.faults++;
+            window_faults++;
+            if (loaded < capacity) loaded++;
+            else s.evictions++;
+        }
+        if (s.window > 0 && (i + 1) % s.window == 0) {
+            s.window_fault_rate.push_back((double)window_faults / s.window);
+            window_faults = 0;
+        }
+    }
+    if (s.window > 0 && n % s.window != 0) s.window_fault_rate.push_back((double)window_faults / (n % s.window));
+}
+
+} // namespace
+
+PageTrace::~PageTrace() {
+    close();
+}
+
+bool PageTrace::open(const std::string& path) {
+    close();
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < header_bytes) {
+        ::close(fd);
+        return false;
+    }
+    void* m = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // The mapping keeps the file alive
+    if (m == MAP_FAILED) return false;
+    mapping = m;
+    mapped_bytes = st.st_size;
+
+    const unsigned char* bytes = static_cast<const unsigned char*>(m);
+    uint64_t n = 0;
+    for (int i = 7; i >= 0; --i) n = n << 8 | bytes[8 + i];
+    if (std::memcmp(bytes, trace_magic, sizeof trace_magic) != 0 || n > (mapped_bytes - header_bytes) / 4) {
+        close();
+        return false;
+    }
+    // Read front to back exactly once
+    madvise(m, mapped_bytes, MADV_SEQUENTIAL);
+    pages = reinterpret_cast<const int32_t*>(bytes + header_bytes);
+    count = n;
+    return true;
+}
+
+void PageTrace::close() {
+    if (mapping) munmap(mapping, mapped_bytes);
+    mapping = nullptr;
+    mapped_bytes = 0;
+    pages = nullptr;
+    count = 0;
+}
+
+PageTraceWriter::~PageTraceWriter() {
+    close();
+}
+
+bool PageTraceWriter::open(const std::string& path) {
+    close();
+    file = std::fopen(path.c_str(), "wb");
+    count = 0;
+    failed = !file;
+    // Count goes in on close
+    unsigned char header[header_bytes] = {};
+    std::memcpy(header, trace_magic, sizeof trace_magic);
+    if (file && std::fwrite(header, 1, header_bytes, file) != header_bytes) failed = true;
+    return !failed;
+}
+
+void PageTraceWriter::write(const int* pages, size_t n) {
+    if (!file) return;
+    static_assert(sizeof(int) == 4, "trace pages are int32");
+    if (std::fwrite(pages, 4, n, file) != n) failed = true;
+    count += n;
+}
+
+bool PageTraceWriter::close() {
+    if (!file) return !failed;
+    unsigned char n[8];
+    for (int i = 0; i < 8; ++i) n[i] = count >> (8 * i) & 0xff;
+    if (std::fseek(file, 8, SEEK_SET) != 0 || std::fwrite(n, 1, 8, file) != 8) failed = true;
+    if (std::fclose(file) != 0) failed = true;
+    file = nullptr;
+    return !failed;
+}
+
+PageTraceSummary replay_page_trace(const PageTrace& trace, int policy, int capacity, int window) {
+    PageTraceSummary s = {};
+    s.references = trace.size();
+    s.window = std::max(window, 0);
+    if (s.window > 0) s.window_fault_rate.reserve((s.references + s.window - 1) / s.window);
+
+    const int32_t* pages = trace.data();
+    long long n = trace.size();
+    bool online = with_online_engine(policy, capacity, [&](auto& engine) {
+        replay(pages, n, engine, capacity, s);
+    });
+    if (!online) {
+        std::vector<int> copy(pages, pages + n);
+        OptEngine engine(copy, capacity);
+        replay(pages, n, engine, capacity, s);
+    }
+    s.hits = s.references - s.faults;
+    return s;
+}
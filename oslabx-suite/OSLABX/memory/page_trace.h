@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// Binary page trace, for replaying traces far too long for a vector<int>.
+//
+// Layout: a 16-byte header (the magic "OSLXPGT1" and a uint64 reference
+// count) followed by that many int32 page numbers, all little-endian.
+// Native builds only: the reader maps the file and reads the pages in place,
+// which assumes a little-endian host, as every target we build is.
+class PageTrace {
+public:
+    PageTrace() = default;
+    ~PageTrace();
+    PageTrace(const PageTrace&) = delete;
+    PageTrace& operator=(const PageTrace&) = delete;
+
+    // Maps a trace file; false if it can't be opened or isn't a valid trace
+    bool open(const std::string& path);
+    void close();
+
+    long long size() const { return count; }
+    const int32_t* data() const { return pages; }
+
+private:
+    void* mapping = nullptr;
+    size_t mapped_bytes = 0;
+    const int32_t* pages = nullptr;
+    long long count = 0;
+};
+
+// Appends references to a binary trace file as they come, so a converter
+// never holds the whole trace either
+class PageTraceWriter {
+public:
+    ~PageTraceWriter();
+
+    bool open(const std::string& path);
+    void write(const int* pages, size_t n);
+    // Fills in the reference count; false if any write failed
+    bool close();
+
+private:
+    std::FILE* file = nullptr;
+    uint64_t count = 0;
+    bool failed = false;
+};
+
+// Counters from a summary-only replay
+struct PageTraceSummary {
+    long long references;
+    long long faults;
+    long long hits;
+    long long evictions;          // Faults that replaced a resident page
+    int window;                   // References per window_fault_rate entry
+    std::vector<double> window_fault_rate; // Last window may be partial
+};
+
+// Runs the trace through a PagePolicy engine, keeping only counters. Memory
+// is the engine's own (O(frames), plus bounded history for ARC, 2Q and LIRS)
+// and one double per window. PAGE_OPTIMAL is offline and has to copy the
+// trace into its next-use table, so it costs O(n) memory instead.
+// window <= 0 leaves window_fault_rate empty.
+PageTraceSummary replay_page_trace(const PageTrace& trace, int policy, int capacity, int window);
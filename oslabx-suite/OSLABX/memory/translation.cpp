@@ -0,0 +1,153 @@
+#include <unordered_map>
+#include <unordered_set>
+#include "translation.h"
+#include "page_replacement.h"
+
+namespace {
+
+// Set-associative TLB. Each set's ways sit side by side, so a lookup is a
+// short linear scan; LRU keeps a last-use stamp per way, FIFO a load stamp.
+class Tlb {
+public:
+    Tlb(int sets, int ways, int policy) : sets(std::max(sets, 1)), ways(std::max(ways, 1)), policy(policy) {
+        tags.assign((size_t)this->sets * this->ways, empty);
+        stamps.assign(tags.size(), 0);
+    }
+
+    bool lookup(uint64_t vpn) {
+        size_t base = set_of(vpn);
+        clock++;
+        for (size_t i = base; i < base + ways; ++i) {
+            if (tags[i] == vpn) {
+                if (policy == TLB_LRU) stamps[i] = clock;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void insert(uint64_t vpn) {
+        size_t base = set_of(vpn);
+        size_t victim = base;
+        if (policy == TLB_RANDOM) {
+            seed ^= seed << 13;
+            seed ^= seed >> 7;
+            seed ^= seed << 17;
+            victim = base + seed % ways;
+        }
+        // An empty way always goes first
+        for (size_t i = base; i < base + ways; ++i) {
+            if (tags[i] == empty) {
+                victim = i;
+                break;
+            }
+            if (policy != TLB_RANDOM && stamps[i] < stamps[victim]) victim = i;
+        }
+        tags[victim] = vpn;
+        stamps[victim] = clock;
+    }
+
+    bool invalidate(uint64_t vpn) {
+        size_t base = set_of(vpn);
+        for (size_t i = base; i < base + ways; ++i) {
+            if (tags[i] == vpn) {
+                tags[i] = empty;
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    static constexpr uint64_t empty = ~0ULL;
+
+    size_t set_of(uint64_t vpn) const { return (size_t)(vpn % sets) * ways; }
+
+    int sets, ways, policy;
+    std::vector<uint64_t> tags;
+    std::vector<uint64_t> stamps;
+    uint64_t clock = 0;
+    uint64_t seed = 88172645463325252ULL;
+};
+
+template <class Engine>
+void translate(const uint64_t* addresses, long long count, const TranslationConfig& config, Engine& engine,
+               TranslationResult& r) {
+    Tlb tlb(config.tlb_sets, config.tlb_ways, config.tlb_policy);
+    int levels = config.level_bits.size();
+    // Index bits below each level; a level l table is picked by vpn >> lower_bits[l - 1]
+    std::vector<int> lower_bits(levels, 0);
+    int below = 0;
+    for (int l = levels - 1; l >= 0; --l) {
+        lower_bits[l] = below;
+        below += config.level_bits[l];
+    }
+    uint64_t vpn_mask = below >= 64 ? ~0ULL : (1ULL << below) - 1;
+    std::vector<std::unordered_set<uint64_t>> tables(levels); // Table prefixes seen per level
+
+    std::unordered_map<uint64_t, int> page_id; // Engines take int pages
+    std::vector<uint64_t> vpn_of;
+    std::vector<int> frame_page;               // Page id per frame slot
+
+    for (long long i = 0; i < count; ++i) {
+        uint64_t vpn = (addresses[i] >> config.page_bits) & vpn_mask;
+        if (tlb.lookup(vpn)) {
+            r.tlb_hits++;
+            continue;
+        }
+
+        r.page_walks++;
+        r.walk_reads += levels;
+        auto it = page_id.find(vpn);
+        if (it == page_id.end()) {
+            // First touch of the page: its path of tables may be new too
+            it = page_id.emplace(vpn, (int)vpn_of.size()).first;
+            vpn_of.push_back(vpn);
+            for (int l = 1; l < levels; ++l) tables[l].insert(vpn >> lower_bits[l - 1]);
+        }
+        PageAccess a = engine.reference(it->second);
+        if (a.fault) {
+            r.page_faults++;
+            if (a.slot >= 0 && a.slot < (int)frame_page.size()) {
+                r.evictions++;
+                r.shootdowns += tlb.invalidate(vpn_of[frame_page[a.slot]]);
+            }
+            if (a.slot == (int)frame_page.size()) frame_page.push_back(it->second);
+            else if (a.slot >= 0) frame_page[a.slot] = it->second;
+        }
+        tlb.insert(vpn);
+    }
+
+    r.page_tables = levels > 0 ? 1 : 0;
+    for (int l = 1; l < levels; ++l) r.page_tables += tables[l].size();
+}
+
+} // namespace
+
+TranslationConfig default_translation_config() {
+    return {12, {9, 9, 9, 9}, 16, 4, TLB_LRU, 1024, PAGE_LRU, 1, 100, 100000};
+}
+
+TranslationResult simulate_translation(const uint64_t* addresses, long long count, const TranslationConfig& config) {
+    TranslationResult r = {};
+    r.accesses = count;
+    bool online = with_online_engine(config.page_policy, config.frames, [&](auto& engine) {
+        translate(addresses, count, config, engine, r);
+    });
+    if (!online) {
+        FifoEngine engine(config.frames);
+        translate(addresses, count, config, engine, r);
+    }
+    r.tlb_misses = r.accesses - r.tlb_hits;
+    r.tlb_hit_rate = count > 0 ? (double)r.tlb_hits / count : 0;
+    r.cycles = (double)count * config.tlb_hit_cycles + (double)r.walk_reads * config.memory_cycles +
+               (double)r.page_faults * config.fault_cycles;
+    r.cycles_per_access = count > 0 ? r.cycles / count : 0;
+    return r;
+}
+
+TranslationResult TranslationSimulator::simulate(std::vector<double> addresses, TranslationConfig config) {
+    std::vector<uint64_t> converted(addresses.size());
+    for (size_t i = 0; i < addresses.size(); ++i) converted[i] = addresses[i] < 0 ? 0 : (uint64_t)addresses[i];
+    return simulate_translation(converted.data(), converted.size(), config);
+}
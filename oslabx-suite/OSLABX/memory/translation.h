@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// Address translation simulator: a set-associative TLB in front of a
+// multi-level page table, with physical frames managed by one of the page
+// replacement engines (page_engines.h).
+//
+// Each address is split into a virtual page number and an offset. A TLB hit
+// costs tlb_hit_cycles. A miss walks the page table, reading one entry per
+// level, and references the page in the frame engine; a page fault there
+// adds fault_cycles, and the evicted page's TLB entry is shot down. The
+// frame engine only sees TLB misses, as the OS only sees what the hardware
+// reports.
+
+enum TlbPolicy {
+    TLB_LRU = 0,
+    TLB_FIFO = 1,
+    TLB_RANDOM = 2
+};
+
+struct TranslationConfig {
+    int page_bits;               // log2 of the page size
+    std::vector<int> level_bits; // Index bits per page-table level, root first
+    int tlb_sets;
+    int tlb_ways;
+    int tlb_policy;              // TlbPolicy
+    int frames;                  // Physical frames
+    int page_policy;             // PagePolicy; PAGE_OPTIMAL needs the future and runs FIFO
+    int tlb_hit_cycles;
+    int memory_cycles;           // Per page-table entry read on a walk
+    int fault_cycles;
+};
+
+// x86-64 style: 4 KiB pages, four 9-bit levels, a 64-entry 4-way LRU TLB,
+// 1024 LRU frames
+TranslationConfig default_translation_config();
+
+// Counters are 64-bit so multi-billion access traces don't wrap
+struct TranslationResult {
+    long long accesses;
+    long long tlb_hits;
+    long long tlb_misses;
+    double tlb_hit_rate;
+    long long page_walks;
+    long long walk_reads;  // Page-table entries read by walks
+    long long page_faults;
+    long long evictions;
+    long long shootdowns;  // TLB entries invalidated by evictions
+    int page_tables;       // Tables the walks needed, root included
+    double cycles;
+    double cycles_per_access;
+};
+
+TranslationResult simulate_translation(const uint64_t* addresses, long long count, const TranslationConfig& config);
+
+class TranslationSimulator {
+public:
+    // Addresses as doubles, exact up to 2^53, which is what JS numbers carry
+    TranslationResult simulate(std::vector<double> addresses, TranslationConfig config);
+};
@@ -0,0 +1,72 @@
+#include <cmath>
+#include "batch.h"
+
+double percentile(std::vector<int>& values, double pct) {
+    if (values.empty()) return 0;
+    size_t rank = (size_t)std::max(1.0, std::ceil(pct / 100.0 * values.size())) - 1;
+    std::nth_element(values.begin(), values.begin() + rank, values.end());
+    return values[rank];
+}
+
+void run_policy(std::vector<Process>& sorted, int policy, int time_quantum) {
+    switch (policy) {
+        case POLICY_FCFS: run_schedule(sorted, FCFSPolicy{}); break;
+        case POLICY_SJF: run_schedule(sorted, SJFPolicy{}); break;
+        case POLICY_ROUND_ROBIN: run_schedule(sorted, RoundRobinPolicy(time_quantum)); break;
+        case POLICY_PRIORITY: run_schedule(sorted, PriorityPolicy{}); break;
+        case POLICY_SRTF: run_schedule(sorted, SRTFPolicy{}); break;
+        case POLICY_PREEMPTIVE_PRIORITY: run_schedule(sorted, PreemptivePriorityPolicy{}); break;
+    }
+}
+
+SweepMetrics summarize(const std::vector<Process>& done, int workload, int policy) {
+    SweepMetrics m = {workload, policy, 0, 0, 0, 0, 0, 0};
+    int n = done.size();
+    if (n == 0) return m;
+
+    std::vector<int> waiting(n), turn_around(n);
+    long long total_waiting = 0, total_turn_around = 0, busy = 0;
+    int first_arrival = done[0].arrival_time, last_completion = done[0].completion_time;
+    for (int i = 0; i < n; ++i) {
+        waiting[i] = done[i].waiting_time;
+        turn_around[i] = done[i].turn_around_time;
+        total_waiting += waiting[i];
+        total_turn_around += turn_around[i];
+        busy += done[i].burst_time;
+        first_arrival = std::min(first_arrival, done[i].arrival_time);
+        last_completion = std::max(last_completion, done[i].completion_time);
+    }
+
+    m.mean_waiting = (double)total_waiting / n;
+    m.mean_turn_around = (double)total_turn_around / n;
+    m.p95_waiting = percentile(waiting, 95);
+    m.p95_turn_around = percentile(turn_around, 95);
+    long long makespan = (long long)last_completion - first_arrival;
+    if (makespan > 0) {
+        m.throughput = (double)n / makespan;
+        m.cpu_utilisation = (double)busy / makespan;
+    }
+    return m;
+}
+
+std::vector<SweepMetrics> BatchScheduler::sweep(std::vector<Process> processes, std::vector<int> offsets,
+                                               std::vector<int> policies, int time_quantum, int threads) {
+    int workloads = offsets.empty() ? 0 : (int)offsets.size() - 1;
+    int per_workload = policies.size();
+
+    // Sort each workload by arrival once; every policy starts from that
+    for (int w = 0; w < workloads; ++w) {
+        std::stable_sort(processes.begin() + offsets[w], processes.begin() + offsets[w + 1],
+            [](const Process& a, const Process& b) { return a.arrival_time < b.arrival_time; });
+    }
+
+    std::vector<SweepMetrics> results(workloads * per_workload);
+    parallel_for((int)results.size(), threads, [&](int task) {
+        int w = task / per_workload;
+        int policy = policies[task % per_workload];
+        std::vector<Process> work(processes.begin() + offsets[w], processes.begin() + offsets[w + 1]);
+        run_policy(work, policy, time_quantum);
+        results[task] = summarize(work, w, policy);
+    });
+    return results;
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include "scheduler.h"
+
+// Runtime policy ids for the batch API; each maps onto one compile-time policy
+enum SchedulingPolicy {
+    POLICY_FCFS = 0,
+    POLICY_SJF = 1,
+    POLICY_ROUND_ROBIN = 2,
+    POLICY_PRIORITY = 3,
+    POLICY_SRTF = 4,
+    POLICY_PREEMPTIVE_PRIORITY = 5
+};
+
+// Aggregate metrics for one (workload, policy) pair
+struct SweepMetrics {
+    int workload;
+    int policy;
+    double mean_waiting;
+    double p95_waiting;
+    double mean_turn_around;
+    double p95_turn_around;
+    double throughput;      // Completed processes per time unit of makespan
+    double cpu_utilisation; // Busy time / makespan, 0..1
+};
+
+// Calls fn(i) for i in [0, count) on up to `threads` workers pulling from a
+// shared counter (threads <= 0 means one per hardware thread). Falls back to
+// the calling thread when threads are unavailable, e.g. WASM without pthreads.
+template <class F>
+void parallel_for(int count, int threads, F&& fn) {
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+    threads = 1;
+#endif
+    if (threads <= 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    threads = std::min(threads, count);
+    if (threads <= 1) {
+        for (int i = 0; i < count; ++i) fn(i);
+        return;
+    }
+
+    std::atomic<int> next{0};
+    auto worker = [&]() {
+        for (int i = next.fetch_add(1); i < count; i = next.fetch_add(1)) fn(i);
+    };
+    std::vector<std::thread> pool;
+    pool.reserve(threads - 1);
+    for (int t = 1; t < threads; ++t) pool.emplace_back(worker);
+    worker();
+    for (auto& t : pool) t.join();
+}
+
+// Nearest-rank percentile; reorders values
+double percentile(std::vector<int>& values, double pct);
+
+// Runs one policy over an arrival-sorted workload (selected at runtime)
+void run_policy(std::vector<Process>& sorted, int policy, int time_quantum);
+
+SweepMetrics summarize(const std::vector<Process>& done, int workload, int policy);
+
+class BatchScheduler {
+public:
+    // processes holds every workload back to back; workload w is
+    // processes[offsets[w], offsets[w + 1]). Every policy in `policies` runs
+    // over every workload; results are ordered workload-major, matching the
+    // order of `policies` within each workload.
+    std::vector<SweepMetrics> sweep(std::vector<Process> processes, std::vector<int> offsets,
+                                    std::vector<int> policies, int time_quantum, int threads);
+};
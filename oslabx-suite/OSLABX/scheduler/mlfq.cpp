@@ -0,0 +1,173 @@
+#include <cstdint>
+#include <climits>
+#include "mlfq.h"
+
+namespace {
+
+// One FIFO list per level, threaded through next[] so requeueing and
+// splicing never allocate
+struct LevelQueues {
+    std::vector<int> head;
+    std::vector<int> tail;
+    std::vector<int> next;
+    uint32_t nonempty = 0; // Bit l set when level l has jobs
+
+    LevelQueues(int levels, int n) : head(levels, -1), tail(levels, -1), next(n, -1) {}
+
+    bool empty() const { return nonempty == 0; }
+
+    void push(int level, int idx) {
+        next[idx] = -1;
+        if (tail[level] == -1) head[level] = idx;
+        else next[tail[level]] = idx;
+        tail[level] = idx;
+        nonempty |= 1u << level;
+    }
+
+    // Pops from the highest non-empty level and reports which one it was
+    int pop(int& level) {
+        level = __builtin_ctz(nonempty);
+        int idx = head[level];
+        head[level] = next[idx];
+        if (head[level] == -1) {
+            tail[level] = -1;
+            nonempty &= ~(1u << level);
+        }
+        return idx;
+    }
+
+    // Appends every lower level to level 0, top to bottom
+    void splice_to_top() {
+        for (int l = 1; l < (int)head.size(); ++l) {
+            if (head[l] == -1) continue;
+            if (tail[0] == -1) head[0] = head[l];
+            else next[tail[0]] = head[l];
+            tail[0] = tail[l];
+            head[l] = tail[l] = -1;
+        }
+        if (nonempty) nonempty = 1;
+    }
+};
+
+} // namespace
+
+void run_mlfq(std::vector<Process>& processes, const std::vector<int>& quantums, int boost_interval,
+              std::vector<GanttSegment>* gantt) {
+    int n = processes.size();
+    int levels = std::min(std::max((int)quantums.size(), 1), 32);
+    int bottom = levels - 1;
+    std::vector<long long> quantum(levels, 1);
+    for (int l = 0; l < levels && l < (int)quantums.size(); ++l) quantum[l] = std::max(1, quantums[l]);
+
+    for (auto& p : processes) p.remaining_time = p.burst_time;
+
+    LevelQueues queues(levels, n);
+    // Allotment used at the current level. It is only valid while epoch[i]
+    // matches boost_epoch; a boost resets everyone lazily by bumping the epoch.
+    std::vector<long long> used(n, 0);
+    std::vector<int> epoch(n, 0);
+    int boost_epoch = 0;
+    long long next_boost = boost_interval > 0 ? boost_interval : LLONG_MAX;
+
+    long long current_time = 0;
+    int next = 0; // Arrival cursor: processes[next..] have not been admitted yet
+
+    auto admit = [&]() {
+        while (next < n && processes[next].arrival_time <= current_time) {
+            used[next] = 0;
+            epoch[next] = boost_epoch;
+            queues.push(0, next);
+            next++;
+        }
+    };
+
+    while (next < n || !queues.empty()) {
+        if (queues.empty() && current_time < processes[next].arrival_time) {
+            // No process available, jump to next arrival. Boosts that fall
+            // in the idle gap have nothing to move.
+            current_time = processes[next].arrival_time;
+            if (next_boost <= current_time) {
+                next_boost = (current_time / boost_interval + 1) * boost_interval;
+            }
+        }
+        admit();
+
+        int level;
+        int idx = queues.pop(level);
+        Process& p = processes[idx];
+        if (epoch[idx] != boost_epoch) {
+            used[idx] = 0;
+            epoch[idx] = boost_epoch;
+        }
+
+        long long next_arrival = next < n ? processes[next].arrival_time : LLONG_MAX;
+        long long left = quantum[level] - used[idx];
+        long long run = p.remaining_time;
+        if (queues.empty() && level == bottom) {
+            // Nothing else is runnable: expiring the allotment would just
+            // requeue this job behind nobody, so only an arrival or a boost
+            // can interrupt it
+            if (next_arrival != LLONG_MAX) {
+                long long gap = next_arrival - current_time;
+                if (level > 0) {
+                    run = std::min(run, gap);
+                } else if (gap <= left) {
+                    run = std::min(run, left);
+                } else {
+                    // Single level: the arrival waits for the next slice boundary
+                    run = std::min(run, left + (gap - left + quantum[level] - 1) / quantum[level] * quantum[level]);
+                }
+            }
+        } else {
+            run = std::min(run, left);
+            if (level > 0) run = std::min(run, next_arrival - current_time);
+        }
+        run = std::min(run, next_boost - current_time);
+
+        if (gantt) append_segment(*gantt, p.id, current_time, current_time + run);
+        current_time += run;
+        p.remaining_time -= run;
+
+        int new_level = level;
+        used[idx] += run;
+        if (used[idx] >= quantum[level]) {
+            if (level < bottom) {
+                new_level = level + 1;
+                used[idx] = 0;
+            } else {
+                used[idx] %= quantum[level];
+            }
+        }
+
+        // New arrivals queue ahead of a preempted job
+        admit();
+
+        bool boosted = false;
+        if (current_time >= next_boost) {
+            queues.splice_to_top();
+            boost_epoch++;
+            next_boost += boost_interval;
+            boosted = true;
+        }
+
+        if (p.remaining_time > 0) {
+            if (boosted) {
+                new_level = 0;
+                used[idx] = 0;
+            }
+            epoch[idx] = boost_epoch;
+            queues.push(new_level, idx);
+        } else {
+            finish_process(p, current_time);
+        }
+    }
+}
+
+ScheduleResult Scheduler::mlfq(std::vector<Process> processes, std::vector<int> quantums, int boost_interval) {
+    ScheduleResult result;
+    run_in_arrival_order(processes, [&](std::vector<Process>& sorted) {
+        run_mlfq(sorted, quantums, boost_interval, &result.gantt);
+    });
+    result.processes = std::move(processes);
+    return result;
+}
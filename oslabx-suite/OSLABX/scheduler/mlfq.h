@@ -0,0 +1,24 @@
+#pragma once
+
+#include <vector>
+#include "scheduler.h"
+
+// Multi-Level Feedback Queue.
+//
+// quantums[l] is the time allotment of level l (level 0 is the highest; at
+// most 32 levels). Rules:
+//   - the highest non-empty level runs; jobs within a level are round robin
+//   - new jobs enter level 0, and an arrival preempts a job running below it
+//   - a job that uses up its allotment at a level, across however many
+//     preemptions, moves down one level (the bottom level is plain RR)
+//   - every boost_interval time units (0 disables) all jobs move back to
+//     level 0 with fresh allotments, keeping their relative level order;
+//     a job interrupted by the boost goes behind them
+// Each event (arrival, completion, allotment expiry, boost) costs O(1): the
+// levels are intrusive FIFO lists, picked via a bitmask of non-empty levels,
+// and a boost splices the lists together instead of moving jobs one by one.
+//
+// processes must be sorted by arrival. Fills in the metrics in place and,
+// when gantt is non-null, records the run-length execution trace.
+void run_mlfq(std::vector<Process>& processes, const std::vector<int>& quantums, int boost_interval,
+              std::vector<GanttSegment>* gantt = nullptr);
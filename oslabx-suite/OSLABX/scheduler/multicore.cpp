@@ -0,0 +1,211 @@
+#include <queue>
+#include <functional>
+#include "multicore.h"
+#include "batch.h"
+
+namespace {
+
+// Slice end of a core; stale once the core's version has moved on
+struct CoreEvent {
+    int time;
+    int core;
+    int version;
+
+    bool operator>(const CoreEvent& o) const { return time != o.time ? time > o.time : core > o.core; }
+};
+
+template <class Policy>
+void simulate_cores(std::vector<Process>& processes, int cores, const Policy& policy, int balancing,
+                    MulticoreResult& result) {
+    int n = processes.size();
+    bool global = balancing == BALANCE_GLOBAL;
+    for (auto& p : processes) p.remaining_time = p.burst_time;
+
+    std::vector<ReadyQueue<Policy>> queues;
+    int queue_count = global ? 1 : cores;
+    queues.reserve(queue_count);
+    for (int q = 0; q < queue_count; ++q) queues.emplace_back(processes);
+
+    std::vector<int> running(cores, -1), start(cores, 0), end(cores, 0), version(cores, 0);
+    std::vector<char> extended(cores, 0); // Dispatched alone: slice runs until cut back
+    std::vector<int> extended_cores;      // Global mode: cores that may need cutting back
+    std::vector<int> busy(cores, 0), dispatches(cores, 0), stolen(cores, 0);
+    std::vector<int> last_core(n, -1);
+    int migrations = 0, balance_moves = 0;
+    std::priority_queue<CoreEvent, std::vector<CoreEvent>, std::greater<CoreEvent>> events;
+
+    std::vector<std::pair<int, int>> preempted; // (core, job) requeued at this instant
+    int idle = cores;
+    int done = n; // Jobs still to finish
+
+    auto schedule_end = [&](int c, int time) {
+        end[c] = time;
+        version[c]++;
+        events.push({time, c, version[c]});
+    };
+
+    auto end_slice = [&](int c, int now) {
+        Process& p = processes[running[c]];
+        int run = now - start[c];
+        p.remaining_time -= run;
+        busy[c] += run;
+        if (p.remaining_time > 0) {
+            preempted.push_back({c, running[c]});
+        } else {
+            finish_process(p, now);
+            done--;
+        }
+        version[c]++;
+        running[c] = -1;
+        extended[c] = 0;
+        idle++;
+    };
+
+    // Something was queued behind a job that was running alone: end its
+    // slice where the single-CPU loop would have (see RoundRobinPolicy).
+    // A boundary at this very instant counts as already reached only while
+    // the instant's requeues are still pending, as they would be on one CPU.
+    auto cut = [&](int c, int now, bool pending) {
+        if (!extended[c]) return;
+        extended[c] = 0;
+        const Process& p = processes[running[c]];
+        int e = start[c] + policy.slice(p, start[c], now, true);
+        if (e == now && !pending) e = start[c] + policy.slice(p, start[c], now + 1, true);
+        if (e == now) end_slice(c, now);
+        else if (e != end[c]) schedule_end(c, e);
+    };
+
+    auto enqueue = [&](int q, int idx, int now, bool pending) {
+        bool was_empty = queues[q].empty();
+        queues[q].push(idx, idx);
+        if (!was_empty) return;
+        if (global) {
+            for (int c : extended_cores) cut(c, now, pending);
+            extended_cores.clear();
+        } else {
+            cut(q, now, pending);
+        }
+    };
+
+    auto load = [&](int c) { return (int)queues[c].size() + (running[c] != -1); };
+
+    auto push_balance = [&](int now) {
+        while (true) {
+            int most = 0, least = 0;
+            for (int c = 1; c < cores; ++c) {
+                if (load(c) > load(most)) most = c;
+                if (load(c) < load(least)) least = c;
+            }
+            if (load(most) - load(least) <= 1 || queues[most].empty()) return;
+            enqueue(least, queues[most].steal(), now, false);
+            balance_moves++;
+            stolen[least]++;
+        }
+    };
+
+    auto dispatch = [&](int c, int now) {
+        auto& q = queues[global ? 0 : c];
+        int idx;
+        if (!q.empty()) {
+            idx = q.pop();
+        } else {
+            if (balancing != BALANCE_STEAL) return;
+            int victim = -1;
+            for (int v = 0; v < cores; ++v) {
+                if (!queues[v].empty() && (victim == -1 || queues[v].size() > queues[victim].size())) victim = v;
+            }
+            if (victim == -1) return;
+            idx = queues[victim].steal();
+            balance_moves++;
+            stolen[c]++;
+        }
+
+        if (last_core[idx] != -1 && last_core[idx] != c) migrations++;
+        last_core[idx] = c;
+        dispatches[c]++;
+        idle--;
+
+        bool alone = q.empty();
+        running[c] = idx;
+        start[c] = now;
+        extended[c] = alone;
+        if (alone && global) extended_cores.push_back(c);
+        schedule_end(c, now + policy.slice(processes[idx], now, INT_MAX, alone));
+    };
+
+    int next = 0; // Arrival cursor: processes[next..] have not been queued yet
+    while (done > 0) {
+        while (!events.empty() && events.top().version != version[events.top().core]) events.pop();
+        int now = events.empty() ? INT_MAX : events.top().time;
+        if (next < n) now = std::min(now, processes[next].arrival_time);
+
+        // Ties come off the heap in core order
+        preempted.clear();
+        while (!events.empty() && events.top().time == now) {
+            CoreEvent e = events.top();
+            events.pop();
+            if (e.version == version[e.core]) end_slice(e.core, now);
+        }
+
+        // New arrivals queue ahead of preempted jobs
+        while (next < n && processes[next].arrival_time <= now) {
+            enqueue(global ? 0 : next % cores, next, now, true);
+            next++;
+        }
+        // With a shared queue, the first requeue is what cuts jobs running alone
+        if (global && !preempted.empty() && queues[0].empty()) {
+            for (int c : extended_cores) cut(c, now, true);
+            extended_cores.clear();
+        }
+        std::sort(preempted.begin(), preempted.end());
+        for (auto& [c, idx] : preempted) enqueue(global ? 0 : c, idx, now, false);
+
+        if (balancing == BALANCE_PUSH) push_balance(now);
+        for (int c = 0; idle > 0 && c < cores; ++c) {
+            if (running[c] == -1) dispatch(c, now);
+        }
+    }
+
+    result.cores.assign(cores, CoreStats{});
+    result.makespan = 0;
+    if (n > 0) {
+        int first_arrival = processes[0].arrival_time, last_completion = processes[0].completion_time;
+        for (auto& p : processes) last_completion = std::max(last_completion, p.completion_time);
+        result.makespan = last_completion - first_arrival;
+    }
+    long long total_busy = 0;
+    int max_busy = 0;
+    for (int c = 0; c < cores; ++c) {
+        double utilisation = result.makespan > 0 ? (double)busy[c] / result.makespan : 0;
+        result.cores[c] = {c, busy[c], utilisation, dispatches[c], stolen[c]};
+        total_busy += busy[c];
+        max_busy = std::max(max_busy, busy[c]);
+    }
+    result.migrations = migrations;
+    result.balance_moves = balance_moves;
+    double mean_busy = (double)total_busy / cores;
+    result.imbalance = mean_busy > 0 ? max_busy / mean_busy - 1 : 0;
+}
+
+} // namespace
+
+void run_multicore(std::vector<Process>& processes, int cores, int policy, int balancing, int time_quantum,
+                   MulticoreResult& result) {
+    cores = std::max(cores, 1);
+    switch (policy) {
+        case POLICY_FCFS: simulate_cores(processes, cores, FCFSPolicy{}, balancing, result); break;
+        case POLICY_SJF: simulate_cores(processes, cores, SJFPolicy{}, balancing, result); break;
+        case POLICY_ROUND_ROBIN: simulate_cores(processes, cores, RoundRobinPolicy(time_quantum), balancing, result); break;
+        case POLICY_PRIORITY: simulate_cores(processes, cores, PriorityPolicy{}, balancing, result); break;
+    }
+}
+
+MulticoreResult MulticoreScheduler::simulate(std::vector<Process> processes, int cores, int policy, int balancing,
+                                             int time_quantum) {
+    MulticoreResult result = {};
+    run_in_arrival_order(processes, [&](std::vector<Process>& sorted) {
+        run_multicore(sorted, cores, policy, balancing, time_quantum, result);
+    });
+    result.processes = std::move(processes);
+    return result;
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <vector>
+#include "scheduler.h"
+
+// How jobs are spread over the cores
+enum BalancingMode {
+    BALANCE_GLOBAL = 0, // One shared run queue; any idle core takes its next job
+    BALANCE_PUSH = 1,   // Per-core queues; after every event the most loaded core
+                        // (queued jobs plus the running one) pushes jobs to the
+                        // least loaded until they differ by at most one
+    BALANCE_STEAL = 2   // Per-core queues; a core that runs dry steals from the
+                        // back of the longest queue
+};
+
+struct CoreStats {
+    int core;
+    int busy_time;
+    double utilisation; // busy_time / makespan, 0..1
+    int dispatches;
+    int stolen;         // Jobs this core pulled in by stealing or had pushed to it
+};
+
+struct MulticoreResult {
+    std::vector<Process> processes; // Input order
+    std::vector<CoreStats> cores;
+    int makespan;                   // First arrival to last completion
+    int migrations;                 // Dispatches of a job on a different core than it last ran on
+    int balance_moves;              // Jobs moved between run queues by push or steal
+    double imbalance;               // Busiest core's busy time over the mean, minus one
+};
+
+// Discrete-event simulation of `cores` CPUs.
+//
+// Each run queue orders jobs with one of the single-CPU policies (FCFS, SJF,
+// Round Robin or Priority; the preemptive policies are not supported here).
+// In the per-core modes an arriving job is placed on core arrival_rank % cores.
+// Events at the same instant are handled as on one CPU: slices end, arrivals
+// are queued, preempted jobs are requeued behind them on the core they ran on,
+// then idle cores dispatch in core order.
+//
+// The cost is O(log n) per event plus O(cores) per balancing pass or steal.
+// A Round Robin job alone on its queue runs as one event until something is
+// queued behind it, when its slice is cut back to the next quantum boundary.
+//
+// processes must be sorted by arrival. Fills in the metrics in place; policy
+// ids that are not supported leave everything untouched.
+void run_multicore(std::vector<Process>& processes, int cores, int policy, int balancing, int time_quantum,
+                   MulticoreResult& result);
+
+class MulticoreScheduler {
+public:
+    // policy is a SchedulingPolicy id (batch.h), balancing a BalancingMode
+    MulticoreResult simulate(std::vector<Process> processes, int cores, int policy, int balancing, int time_quantum);
+};
@@ -0,0 +1,87 @@
+#include "scheduler.h"
+
+static ProcessArrays arrays(uintptr_t ids, uintptr_t arrivals, uintptr_t bursts, uintptr_t priorities, int n,
+                            uintptr_t completion, uintptr_t waiting, uintptr_t turn_around) {
+    return {
+        reinterpret_cast<const int*>(ids),
+        reinterpret_cast<const int*>(arrivals),
+        reinterpret_cast<const int*>(bursts),
+        reinterpret_cast<const int*>(priorities),
+        reinterpret_cast<int*>(completion),
+        reinterpret_cast<int*>(waiting),
+        reinterpret_cast<int*>(turn_around),
+        n
+    };
+}
+
+static void sort_by_arrival(std::vector<Process>& processes) {
+    std::stable_sort(processes.begin(), processes.end(), [](const Process& a, const Process& b) {
+        return a.arrival_time < b.arrival_time;
+    });
+}
+
+std::vector<Process> Scheduler::fcfs(std::vector<Process> processes) {
+    sort_by_arrival(processes);
+    run_schedule(processes, FCFSPolicy{});
+    return processes;
+}
+
+std::vector<Process> Scheduler::sjf(std::vector<Process> processes) {
+    run_schedule_in_place(processes, SJFPolicy{});
+    return processes;
+}
+
+std::vector<Process> Scheduler::round_robin(std::vector<Process> processes, int time_quantum) {
+    sort_by_arrival(processes);
+    run_schedule(processes, RoundRobinPolicy(time_quantum));
+    return processes;
+}
+
+std::vector<Process> Scheduler::priority_scheduling(std::vector<Process> processes) {
+    run_schedule_in_place(processes, PriorityPolicy{});
+    return processes;
+}
+
+ScheduleResult Scheduler::srtf(std::vector<Process> processes) {
+    ScheduleResult result;
+    run_schedule_in_place(processes, SRTFPolicy{}, &result.gantt);
+    result.processes = std::move(processes);
+    return result;
+}
+
+ScheduleResult Scheduler::preemptive_priority(std::vector<Process> processes) {
+    ScheduleResult result;
+    run_schedule_in_place(processes, PreemptivePriorityPolicy{}, &result.gantt);
+    result.processes = std::move(processes);
+    return result;
+}
+
+void Scheduler::fcfs_arrays(uintptr_t ids, uintptr_t arrivals, uintptr_t bursts, uintptr_t priorities, int n,
+                            uintptr_t completion, uintptr_t waiting, uintptr_t turn_around) {
+    run_schedule_arrays(arrays(ids, arrivals, bursts, priorities, n, completion, waiting, turn_around), FCFSPolicy{});
+}
+
+void Scheduler::sjf_arrays(uintptr_t ids, uintptr_t arrivals, uintptr_t bursts, uintptr_t priorities, int n,
+                           uintptr_t completion, uintptr_t waiting, uintptr_t turn_around) {
+    run_schedule_arrays(arrays(ids, arrivals, bursts, priorities, n, completion, waiting, turn_around), SJFPolicy{});
+}
+
+void Scheduler::round_robin_arrays(uintptr_t ids, uintptr_t arrivals, uintptr_t bursts, uintptr_t priorities, int n,
+                                   uintptr_t completion, uintptr_t waiting, uintptr_t turn_around, int time_quantum) {
+    run_schedule_arrays(arrays(ids, arrivals, bursts, priorities, n, completion, waiting, turn_around), RoundRobinPolicy(time_quantum));
+}
+
+void Scheduler::priority_scheduling_arrays(uintptr_t ids, uintptr_t arrivals, uintptr_t bursts, uintptr_t priorities, int n,
+                                           uintptr_t completion, uintptr_t waiting, uintptr_t turn_around) {
+    run_schedule_arrays(arrays(ids, arrivals, bursts, priorities, n, completion, waiting, turn_around), PriorityPolicy{});
+}
+
+void Scheduler::srtf_arrays(uintptr_t ids, uintptr_t arrivals, uintptr_t bursts, uintptr_t priorities, int n,
+                            uintptr_t completion, uintptr_t waiting, uintptr_t turn_around) {
+    run_schedule_arrays(arrays(ids, arrivals, bursts, priorities, n, completion, waiting, turn_around), SRTFPolicy{});
+}
+
+void Scheduler::preemptive_priority_arrays(uintptr_t ids, uintptr_t arrivals, uintptr_t bursts, uintptr_t priorities, int n,
+                                           uintptr_t completion, uintptr_t waiting, uintptr_t turn_around) {
+    run_schedule_arrays(arrays(ids, arrivals, bursts, priorities, n, completion, waiting, turn_around), PreemptivePriorityPolicy{});
+}
@@ -0,0 +1,320 @@
+#pragma once
+
+#include <vector>
+#include <deque>
+#include <algorithm>
+#include <climits>
+#include <utility>
+#include <cstdint>
+
+struct Process {
+    int id;
+    int burst_time;
+    int arrival_time;
+    int priority; // Lower value = Higher priority (convention)
+    int remaining_time;
+    int completion_time;
+    int waiting_time;
+    int turn_around_time;
+};
+
+// One run-length slice of the Gantt chart: pid ran over [start, end)
+struct GanttSegment {
+    int pid;
+    int start;
+    int end;
+};
+
+struct ScheduleResult {
+    std::vector<Process> processes;
+    std::vector<GanttSegment> gantt;
+};
+
+// Selection policies.
+//
+// A policy is a small type the scheduling core is instantiated with, so its
+// comparisons inline into the dispatch loop. It provides:
+//   static constexpr bool fifo       - true: ready queue is FIFO, false: min-heap
+//   static int key(const Process&)   - heap ordering key (lower runs first),
+//                                      only needed when fifo is false
+//   int slice(p, now, next_arrival, alone) const
+//                                    - how long the dispatched job runs before
+//                                      the core re-decides. next_arrival is
+//                                      INT_MAX when no arrivals remain, alone
+//                                      is true when nothing else is ready.
+// Ties on key are broken by arrival order (then input order).
+
+struct FCFSPolicy {
+    static constexpr bool fifo = true;
+    int slice(const Process& p, int, int, bool) const { return p.remaining_time; }
+};
+
+struct SJFPolicy {
+    static constexpr bool fifo = false;
+    static int key(const Process& p) { return p.burst_time; }
+    int slice(const Process& p, int, int, bool) const { return p.remaining_time; }
+};
+
+struct PriorityPolicy {
+    static constexpr bool fifo = false;
+    static int key(const Process& p) { return p.priority; }
+    int slice(const Process& p, int, int, bool) const { return p.remaining_time; }
+};
+
+// Preemptive policies run until completion or the next arrival, whichever is first
+struct SRTFPolicy {
+    static constexpr bool fifo = false;
+    static int key(const Process& p) { return p.remaining_time; }
+    int slice(const Process& p, int now, int next_arrival, bool) const {
+        return std::min<long long>(p.remaining_time, (long long)next_arrival - now);
+    }
+};
+
+struct PreemptivePriorityPolicy {
+    static constexpr bool fifo = false;
+    static int key(const Process& p) { return p.priority; }
+    int slice(const Process& p, int now, int next_arrival, bool) const {
+        return std::min<long long>(p.remaining_time, (long long)next_arrival - now);
+    }
+};
+
+struct RoundRobinPolicy {
+    static constexpr bool fifo = true;
+    int quantum;
+
+    explicit RoundRobinPolicy(int time_quantum) : quantum(time_quantum < 1 ? 1 : time_quantum) {}
+
+    int slice(const Process& p, int now, int next_arrival, bool alone) const {
+        if (!alone) return std::min(quantum, p.remaining_time);
+        // Only this job is runnable. It would be re-queued behind nobody
+        // until the first slice boundary at or after the next arrival,
+        // so collapse those slices into a single step.
+        long long slices = (p.remaining_time + (long long)quantum - 1) / quantum;
+        if (next_arrival != INT_MAX) {
+            long long gap = (long long)next_arrival - now;
+            slices = std::min(slices, std::max(1LL, (gap + quantum - 1) / quantum));
+        }
+        return std::min<long long>(p.remaining_time, slices * quantum);
+    }
+};
+
+// Ready queue, chosen at compile time from Policy::fifo.
+// push() takes the job's arrival rank, used to break ties on equal keys.
+template <class Policy, bool Fifo = Policy::fifo>
+class ReadyQueue;
+
+template <class Policy>
+class ReadyQueue<Policy, true> {
+public:
+    explicit ReadyQueue(const std::vector<Process>&) {}
+
+    bool empty() const { return q.empty(); }
+    size_t size() const { return q.size(); }
+    void push(int idx, int) { q.push_back(idx); }
+    int pop() {
+        int idx = q.front();
+        q.pop_front();
+        return idx;
+    }
+    // Takes the job that would run last, for work stealing
+    int steal() {
+        int idx = q.back();
+        q.pop_back();
+        return idx;
+    }
+
+private:
+    std::deque<int> q;
+};
+
+template <class Policy>
+class ReadyQueue<Policy, false> {
+public:
+    explicit ReadyQueue(const std::vector<Process>& processes) : procs(processes) {}
+
+    bool empty() const { return heap.empty(); }
+    size_t size() const { return heap.size(); }
+    void reserve(size_t n) { heap.reserve(n); }
+
+    void push(int idx, int rank) {
+        heap.push_back({Policy::key(procs[idx]), rank, idx});
+        std::push_heap(heap.begin(), heap.end(), after);
+    }
+
+    int pop() {
+        std::pop_heap(heap.begin(), heap.end(), after);
+        int idx = heap.back().idx;
+        heap.pop_back();
+        return idx;
+    }
+    // Takes a heap leaf, for work stealing: O(1) and never the next job to run
+    // unless it is the only one
+    int steal() {
+        int idx = heap.back().idx;
+        heap.pop_back();
+        return idx;
+    }
+
+private:
+    struct Entry {
+        int key;
+        int rank;
+        int idx;
+    };
+
+    // Heap comparator: true when a should run after b
+    static bool after(const Entry& a, const Entry& b) {
+        return a.key != b.key ? a.key > b.key : a.rank > b.rank;
+    }
+
+    const std::vector<Process>& procs;
+    std::vector<Entry> heap;
+};
+
+inline void finish_process(Process& p, int completion_time) {
+    p.completion_time = completion_time;
+    p.turn_around_time = p.completion_time - p.arrival_time;
+    p.waiting_time = p.turn_around_time - p.burst_time;
+}
+
+inline void append_segment(std::vector<GanttSegment>& gantt, int pid, int start, int end) {
+    if (end <= start) return;
+    // Extend the previous segment when the same job keeps the CPU
+    if (!gantt.empty() && gantt.back().pid == pid && gantt.back().end == start) {
+        gantt.back().end = end;
+    } else {
+        gantt.push_back({pid, start, end});
+    }
+}
+
+// Scheduling core shared by every policy.
+// processes must already be sorted by arrival (stable), so an index doubles
+// as the arrival rank. Fills in completion/turnaround/waiting in place and,
+// when gantt is non-null, records the run-length execution trace.
+template <class Policy>
+void run_schedule(std::vector<Process>& processes, const Policy& policy, std::vector<GanttSegment>* gantt = nullptr) {
+    int n = processes.size();
+    for (auto& p : processes) p.remaining_time = p.burst_time;
+
+    ReadyQueue<Policy> ready(processes);
+    if constexpr (!Policy::fifo) ready.reserve(n);
+
+    int current_time = 0;
+    int next = 0; // Arrival cursor: processes[next..] have not been admitted yet
+    while (next < n || !ready.empty()) {
+        if (ready.empty() && current_time < processes[next].arrival_time) {
+            // No process available, jump to next arrival
+            current_time = processes[next].arrival_time;
+        }
+        while (next < n && processes[next].arrival_time <= current_time) {
+            ready.push(next, next);
+            next++;
+        }
+
+        int idx = ready.pop();
+        Process& p = processes[idx];
+        int next_arrival = next < n ? processes[next].arrival_time : INT_MAX;
+        int run = policy.slice(p, current_time, next_arrival, ready.empty());
+
+        if (gantt) append_segment(*gantt, p.id, current_time, current_time + run);
+        current_time += run;
+        p.remaining_time -= run;
+
+        // New arrivals queue ahead of a preempted job
+        while (next < n && processes[next].arrival_time <= current_time) {
+            ready.push(next, next);
+            next++;
+        }
+
+        if (p.remaining_time > 0) {
+            ready.push(idx, idx);
+        } else {
+            finish_process(p, current_time);
+        }
+    }
+}
+
+// Hands run() an arrival-sorted copy and scatters the results back, so the
+// output keeps the caller's input order.
+template <class Run>
+void run_in_arrival_order(std::vector<Process>& processes, Run&& run) {
+    int n = processes.size();
+    std::vector<std::pair<int, int>> order(n);
+    for (int i = 0; i < n; ++i) order[i] = {processes[i].arrival_time, i};
+    std::sort(order.begin(), order.end());
+
+    std::vector<Process> sorted(n);
+    for (int i = 0; i < n; ++i) sorted[i] = processes[order[i].second];
+    run(sorted);
+    for (int i = 0; i < n; ++i) processes[order[i].second] = sorted[i];
+}
+
+template <class Policy>
+void run_schedule_in_place(std::vector<Process>& processes, const Policy& policy, std::vector<GanttSegment>* gantt = nullptr) {
+    run_in_arrival_order(processes, [&](std::vector<Process>& sorted) { run_schedule(sorted, policy, gantt); });
+}
+
+// Structure-of-arrays view over caller-owned buffers, e.g. Int32Array views
+// into WASM linear memory. Row i of every array describes the same process;
+// priorities may be null for policies that ignore it.
+struct ProcessArrays {
+    const int* ids;
+    const int* arrivals;
+    const int* bursts;
+    const int* priorities;
+    int* completion;
+    int* waiting;
+    int* turn_around;
+    int n;
+};
+
+// Same as run_schedule_in_place, but reads inputs from and writes metrics to
+// the caller's arrays, indexed by input row.
+template <class Policy>
+void run_schedule_arrays(const ProcessArrays& a, const Policy& policy) {
+    std::vector<std::pair<int, int>> order(a.n);
+    for (int i = 0; i < a.n; ++i) order[i] = {a.arrivals[i], i};
+    std::sort(order.begin(), order.end());
+
+    std::vector<Process> sorted(a.n);
+    for (int i = 0; i < a.n; ++i) {
+        int row = order[i].second;
+        int priority = a.priorities ? a.priorities[row] : 0;
+        sorted[i] = {a.ids[row], a.bursts[row], a.arrivals[row], priority, a.bursts[row], 0, 0, 0};
+    }
+    run_schedule(sorted, policy);
+    for (int i = 0; i < a.n; ++i) {
+        int row = order[i].second;
+        a.completion[row] = sorted[i].completion_time;
+        a.waiting[row] = sorted[i].waiting_time;
+        a.turn_around[row] = sorted[i].turn_around_time;
+    }
+}
+
+class Scheduler {
+public:
+    std::vector<Process> fcfs(std::vector<Process> processes); // Results come back sorted by arrival
+    std::vector<Process> sjf(std::vector<Process> processes); // Non-preemptive, results in input order
+    std::vector<Process> round_robin(std::vector<Process> processes, int time_quantum); // Results come back sorted by arrival
+    std::vector<Process> priority_scheduling(std::vector<Process> processes); // Non-preemptive, results in input order
+    ScheduleResult srtf(std::vector<Process> processes); // Preemptive SJF (Shortest Remaining Time First)
+    ScheduleResult preemptive_priority(std::vector<Process> processes);
+    // Multi-Level Feedback Queue, one level per quantum (see mlfq.h)
+    ScheduleResult mlfq(std::vector<Process> processes, std::vector<int> quantums, int boost_interval);
+
+    // Typed-array entry points. Each argument is a byte offset into linear
+    // memory of an int32 array with n elements (priorities may be 0). Results
+    // are written in input row order, whatever the policy.
+    void fcfs_arrays(uintptr_t ids, uintptr_t arrivals, uintptr_t bursts, uintptr_t priorities, int n,
+                     uintptr_t completion, uintptr_t waiting, uintptr_t turn_around);
+    void sjf_arrays(uintptr_t ids, uintptr_t arrivals, uintptr_t bursts, uintptr_t priorities, int n,
+                    uintptr_t completion, uintptr_t waiting, uintptr_t turn_around);
+    void round_robin_arrays(uintptr_t ids, uintptr_t arrivals, uintptr_t bursts, uintptr_t priorities, int n,
+                            uintptr_t completion, uintptr_t waiting, uintptr_t turn_around, int time_quantum);
+    void priority_scheduling_arrays(uintptr_t ids, uintptr_t arrivals, uintptr_t bursts, uintptr_t priorities, int n,
+                                    uintptr_t completion, uintptr_t waiting, uintptr_t turn_around);
+    void srtf_arrays(uintptr_t ids, uintptr_t arrivals, uintptr_t bursts, uintptr_t priorities, int n,
+                     uintptr_t completion, uintptr_t waiting, uintptr_t turn_around);
+    void preemptive_priority_arrays(uintptr_t ids, uintptr_t arrivals, uintptr_t bursts, uintptr_t priorities, int n,
+                                    uintptr_t completion, uintptr_t waiting, uintptr_t turn_around);
+};
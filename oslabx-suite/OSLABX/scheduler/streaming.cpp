@@ -0,0 +1,137 @@
+#include <deque>
+#include "streaming.h"
+#include "batch.h"
+
+struct StreamingScheduler::Core {
+    std::deque<Process> arrivals; // Pushed but not admitted yet, in arrival order
+    int watermark = INT_MIN;      // Latest arrival pushed; later ones can't be earlier
+    bool ended = false;
+
+    virtual ~Core() = default;
+    // Runs as far as the known arrivals allow, appending finished processes to out
+    virtual void advance(std::vector<Process>& out) = 0;
+    virtual int held() const = 0;
+};
+
+namespace {
+
+// run_schedule's loop, turned inside out so it can stop whenever the next
+// decision depends on arrivals that haven't been pushed yet
+template <class Policy>
+class StreamCore : public StreamingScheduler::Core {
+public:
+    explicit StreamCore(const Policy& p) : policy(p), ready(pool) {}
+
+    void advance(std::vector<Process>& out) override {
+        while (true) {
+            if (preempted != -1) {
+                // New arrivals queue ahead of a preempted job
+                if (!can_decide()) return;
+                admit();
+                ready.push(preempted, rank[preempted]);
+                preempted = -1;
+            }
+            if (ready.empty()) {
+                if (arrivals.empty()) return;
+                // No process available, jump to next arrival
+                current_time = std::max(current_time, arrivals.front().arrival_time);
+            }
+            if (!can_decide()) return;
+            admit();
+
+            int slot = ready.pop();
+            Process& p = pool[slot];
+            // Unpushed arrivals can't come before the watermark, and a slice
+            // ending there is re-decided once they are known
+            int next_arrival = !arrivals.empty() ? arrivals.front().arrival_time : ended ? INT_MAX : watermark;
+            int run = policy.slice(p, current_time, next_arrival, ready.empty());
+            current_time += run;
+            p.remaining_time -= run;
+
+            if (p.remaining_time > 0) {
+                preempted = slot;
+            } else {
+                finish_process(p, current_time);
+                out.push_back(p);
+                free_slots.push_back(slot);
+            }
+        }
+    }
+
+    int held() const override { return pool.size() - free_slots.size(); }
+
+private:
+    // Every arrival up to current_time is known
+    bool can_decide() const { return ended || watermark > current_time; }
+
+    void admit() {
+        while (!arrivals.empty() && arrivals.front().arrival_time <= current_time) {
+            int slot;
+            if (free_slots.empty()) {
+                slot = pool.size();
+                pool.push_back(arrivals.front());
+                rank.push_back(0);
+            } else {
+                slot = free_slots.back();
+                free_slots.pop_back();
+                pool[slot] = arrivals.front();
+            }
+            arrivals.pop_front();
+            pool[slot].remaining_time = pool[slot].burst_time;
+            rank[slot] = admitted++;
+            ready.push(slot, rank[slot]);
+        }
+    }
+
+    Policy policy;
+    std::vector<Process> pool;   // Admitted, unfinished jobs; slots are reused
+    std::vector<int> rank;       // Arrival rank per slot, breaks ties on equal keys
+    std::vector<int> free_slots;
+    ReadyQueue<Policy> ready;
+    int current_time = 0;
+    int preempted = -1;          // Slot whose slice ended but isn't requeued yet
+    int admitted = 0;
+};
+
+} // namespace
+
+StreamingScheduler::StreamingScheduler(int policy, int time_quantum) {
+    switch (policy) {
+        case POLICY_SJF: core = std::make_unique<StreamCore<SJFPolicy>>(SJFPolicy{}); break;
+        case POLICY_ROUND_ROBIN: core = std::make_unique<StreamCore<RoundRobinPolicy>>(RoundRobinPolicy(time_quantum)); break;
+        case POLICY_PRIORITY: core = std::make_unique<StreamCore<PriorityPolicy>>(PriorityPolicy{}); break;
+        case POLICY_SRTF: core = std::make_unique<StreamCore<SRTFPolicy>>(SRTFPolicy{}); break;
+        case POLICY_PREEMPTIVE_PRIORITY:
+            core = std::make_unique<StreamCore<PreemptivePriorityPolicy>>(PreemptivePriorityPolicy{});
+            break;
+        default: core = std::make_unique<StreamCore<FCFSPolicy>>(FCFSPolicy{}); break;
+    }
+}
+
+StreamingScheduler::~StreamingScheduler() = default;
+
+std::vector<Process> StreamingScheduler::push(std::vector<Process> chunk) {
+    std::stable_sort(chunk.begin(), chunk.end(), [](const Process& a, const Process& b) {
+        return a.arrival_time < b.arrival_time;
+    });
+    for (auto& p : chunk) {
+        p.arrival_time = std::max(p.arrival_time, core->watermark);
+        core->watermark = p.arrival_time;
+        core->arrivals.push_back(p);
+    }
+
+    std::vector<Process> finished;
+    core->advance(finished);
+    return finished;
+}
+
+std::vector<Process> StreamingScheduler::finish() {
+    core->ended = true;
+    std::vector<Process> finished;
+    core->advance(finished);
+    return finished;
+}
+
+int StreamingScheduler::live() const {
+    return core->arrivals.size() + core->held();
+}
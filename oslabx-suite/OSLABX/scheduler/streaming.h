@@ -0,0 +1,34 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+#include "scheduler.h"
+
+// Incremental scheduler for traces too large to hold at once.
+//
+// Feed processes in arrival order with push(), in chunks of any size; each
+// call returns the processes that finished as a result, in completion order,
+// with their metrics filled in. Simulated time only advances past instants
+// whose arrivals are all known, so the results match the batch schedulers.
+// Memory is proportional to the live set (ready jobs plus arrivals not yet
+// admitted), not to the trace.
+//
+// A chunk is sorted by arrival on the way in; a process arriving before one
+// from an earlier chunk is treated as arriving at that earlier time.
+class StreamingScheduler {
+public:
+    // policy is a SchedulingPolicy id (batch.h); unknown ids run FCFS
+    StreamingScheduler(int policy, int time_quantum);
+    ~StreamingScheduler();
+
+    std::vector<Process> push(std::vector<Process> chunk);
+    // Ends the stream and runs every remaining process to completion
+    std::vector<Process> finish();
+    // Processes currently held: ready or running, plus not yet admitted
+    int live() const;
+
+    struct Core;
+
+private:
+    std::unique_ptr<Core> core;
+};
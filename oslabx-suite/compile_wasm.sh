@@ -1,38 +1,61 @@
 #!/bin/bash
 set -e
 
+# Each module is its thin binding file from OSLABX/bindings plus the engine
+# sources it uses. For a native build of the same engines see OSLABX/CMakeLists.txt.
+
 echo "Compiling WASM modules..."
 mkdir -p frontend/public/wasm
 
 # API Options for reusable modules
-OPTS="-O3 -s WASM=1 -s MODULARIZE=1 -s ALLOW_MEMORY_GROWTH=1 --bind"
+OPTS="-O3 -s WASM=1 -s MODULARIZE=1 -s ALLOW_MEMORY_GROWTH=1 --bind -I OSLABX"
+# Modules with typed-array views into linear memory: the schedulers' *_arrays entry
+# points and the disk scheduler's trace_array and SeekTrace.runs_data
+TYPED_ARRAY_OPTS="$OPTS -s EXPORTED_FUNCTIONS=['_malloc','_free'] -s EXPORTED_RUNTIME_METHODS=['HEAP32']"
 
 # Scheduler
 echo "Compiling FCFS..."
-emcc OSLABX/scheduler/fcfs.cpp -o frontend/public/wasm/fcfs.js $OPTS -s EXPORT_NAME='createFCFSModule'
+emcc OSLABX/bindings/fcfs.cpp OSLABX/scheduler/scheduler.cpp -o frontend/public/wasm/fcfs.js $TYPED_ARRAY_OPTS -s EXPORT_NAME='createFCFSModule'
 echo "Compiling SJF..."
-emcc OSLABX/scheduler/sjf.cpp -o frontend/public/wasm/sjf.js $OPTS -s EXPORT_NAME='createSJFModule'
+emcc OSLABX/bindings/sjf.cpp OSLABX/scheduler/scheduler.cpp -o frontend/public/wasm/sjf.js $TYPED_ARRAY_OPTS -s EXPORT_NAME='createSJFModule'
 echo "Compiling Round Robin..."
-emcc OSLABX/scheduler/round_robin.cpp -o frontend/public/wasm/round_robin.js $OPTS -s EXPORT_NAME='createRRModule'
+emcc OSLABX/bindings/round_robin.cpp OSLABX/scheduler/scheduler.cpp -o frontend/public/wasm/round_robin.js $TYPED_ARRAY_OPTS -s EXPORT_NAME='createRRModule'
 echo "Compiling Priority..."
-emcc OSLABX/scheduler/priority.cpp -o frontend/public/wasm/priority.js $OPTS -s EXPORT_NAME='createPriorityModule'
+emcc OSLABX/bindings/priority.cpp OSLABX/scheduler/scheduler.cpp -o frontend/public/wasm/priority.js $TYPED_ARRAY_OPTS -s EXPORT_NAME='createPriorityModule'
+echo "Compiling MLFQ..."
+emcc OSLABX/bindings/mlfq.cpp OSLABX/scheduler/scheduler.cpp OSLABX/scheduler/mlfq.cpp -o frontend/public/wasm/mlfq.js $OPTS -s EXPORT_NAME='createMLFQModule'
+echo "Compiling Multi-core Scheduler..."
+emcc OSLABX/bindings/multicore.cpp OSLABX/scheduler/multicore.cpp -o frontend/public/wasm/multicore.js $OPTS -s EXPORT_NAME='createMulticoreModule'
+echo "Compiling Streaming Scheduler..."
+emcc OSLABX/bindings/streaming.cpp OSLABX/scheduler/streaming.cpp -o frontend/public/wasm/streaming.js $OPTS -s EXPORT_NAME='createStreamingModule'
+echo "Compiling Scheduler Sweep..."
+# Uses pthreads: the page must be cross-origin isolated (COOP/COEP) for SharedArrayBuffer
+emcc OSLABX/bindings/sweep.cpp OSLABX/scheduler/batch.cpp -o frontend/public/wasm/sweep.js $OPTS -pthread -s PTHREAD_POOL_SIZE=navigator.hardwareConcurrency -s EXPORT_NAME='createSweepModule'
 
 # Memory
 echo "Compiling Memory Fit..."
-emcc OSLABX/memory/fit_strategies.cpp -o frontend/public/wasm/memory_fit.js $OPTS -s EXPORT_NAME='createMemoryFitModule'
+emcc OSLABX/bindings/memory_fit.cpp OSLABX/memory/fit_strategies.cpp -o frontend/public/wasm/memory_fit.js $OPTS -s EXPORT_NAME='createMemoryFitModule'
+echo "Compiling Allocator Simulator..."
+emcc OSLABX/bindings/allocator.cpp OSLABX/memory/allocator.cpp -o frontend/public/wasm/allocator.js $OPTS -s EXPORT_NAME='createAllocatorModule'
 echo "Compiling Page Replacement..."
-emcc OSLABX/memory/page_replacement.cpp -o frontend/public/wasm/page_replacement.js $OPTS -s EXPORT_NAME='createPageReplacementModule'
+emcc OSLABX/bindings/page_replacement.cpp OSLABX/memory/page_replacement.cpp OSLABX/memory/page_engines.cpp OSLABX/memory/miss_ratio.cpp -o frontend/public/wasm/page_replacement.js $OPTS -s EXPORT_NAME='createPageReplacementModule'
+echo "Compiling Address Translation..."
+emcc OSLABX/bindings/translation.cpp OSLABX/memory/translation.cpp OSLABX/memory/page_engines.cpp -o frontend/public/wasm/translation.js $OPTS -s EXPORT_NAME='createTranslationModule'
 
 # Disk
 echo "Compiling Disk Scheduling..."
-emcc OSLABX/disk/disk_scheduling.cpp -o frontend/public/wasm/disk_scheduling.js $OPTS -s EXPORT_NAME='createDiskSchedulingModule'
+emcc OSLABX/bindings/disk_scheduling.cpp OSLABX/disk/disk_scheduling.cpp -o frontend/public/wasm/disk_scheduling.js $TYPED_ARRAY_OPTS -s EXPORT_NAME='createDiskSchedulingModule'
+echo "Compiling Disk Simulator..."
+emcc OSLABX/bindings/disk_simulator.cpp OSLABX/disk/disk_simulator.cpp -o frontend/public/wasm/disk_simulator.js $OPTS -s EXPORT_NAME='createDiskSimulatorModule'
 
 # File System
 echo "Compiling File Allocation..."
-emcc OSLABX/fileSystem/file_allocation.cpp -o frontend/public/wasm/file_allocation.js $OPTS -s EXPORT_NAME='createFileAllocationModule'
+emcc OSLABX/bindings/file_allocation.cpp OSLABX/fileSystem/file_allocation.cpp OSLABX/fileSystem/free_space.cpp -o frontend/public/wasm/file_allocation.js $OPTS -s EXPORT_NAME='createFileAllocationModule'
+echo "Compiling File System Simulator..."
+emcc OSLABX/bindings/fs_simulator.cpp OSLABX/fileSystem/fs_simulator.cpp OSLABX/fileSystem/free_space.cpp -o frontend/public/wasm/fs_simulator.js $OPTS -s EXPORT_NAME='createFsSimulatorModule'
 
 # Deadlock
 echo "Compiling Banker..."
-emcc OSLABX/deadlock/banker.cpp -o frontend/public/wasm/banker.js $OPTS -s EXPORT_NAME='createBankerModule'
+emcc OSLABX/bindings/banker.cpp OSLABX/deadlock/banker.cpp -o frontend/public/wasm/banker.js $OPTS -s EXPORT_NAME='createBankerModule'
 
 echo "WASM compilation complete."
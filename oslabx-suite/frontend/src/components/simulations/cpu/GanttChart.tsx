@@ -2,6 +2,7 @@
 
 import React from 'react';
 import { ResponsiveContainer, BarChart, Bar, XAxis, YAxis, Tooltip, Cell } from 'recharts';
+import { GanttSegment } from '@/types/wasm';
 
 interface GanttData {
     name: string;
@@ -10,6 +11,19 @@ interface GanttData {
     color: string;
 }
 
+const COLORS = ['#60a5fa', '#a78bfa', '#f472b6', '#34d399', '#fbbf24'];
+
+// Preemptive engines return run-length segments, so each one maps to a single bar
+// regardless of how long the trace is.
+export function segmentsToGanttData(segments: GanttSegment[]): GanttData[] {
+    return segments.map(s => ({
+        name: `P${s.pid}`,
+        start: s.start,
+        duration: s.end - s.start,
+        color: COLORS[s.pid % COLORS.length]
+    }));
+}
+
 export default function GanttChart({ data }: { data: GanttData[] }) {
     // Pre-process data for stacked bar chart to look like a Gantt chart
     // Recharts doesn't have a native Gantt, so we use a stacked bar with a transparent base.
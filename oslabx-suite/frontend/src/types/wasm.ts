@@ -9,14 +9,48 @@ export interface Process {
     turn_around_time?: number;
 }
 
+// Run-length Gantt slice: pid ran over [start, end)
+export interface GanttSegment {
+    pid: number;
+    start: number;
+    end: number;
+}
+
+export interface ScheduleResult {
+    processes: any; // vector<Process>
+    gantt: any; // vector<GanttSegment>
+}
+
+type ArraysEntry = (
+    ids: number, arrivals: number, bursts: number, priorities: number, n: number,
+    completion: number, waiting: number, turnaround: number
+) => void;
+
 export interface SchedulerModule {
     Scheduler: new () => {
         fcfs: (processes: any) => any; // Returns vector<Process>
         sjf: (processes: any) => any;
         round_robin: (processes: any, quantum: number) => any;
         priority_scheduling: (processes: any) => any;
+        srtf?: (processes: any) => ScheduleResult;
+        preemptive_priority?: (processes: any) => ScheduleResult;
+        // quantums: vector<int>, one allotment per level; boost_interval 0 disables boosts
+        mlfq?: (processes: any, quantums: any, boost_interval: number) => ScheduleResult;
+        // Typed-array variants: byte offsets of Int32Arrays allocated with _malloc.
+        // Results are written per input row into completion/waiting/turnaround.
+        fcfs_arrays?: ArraysEntry;
+        sjf_arrays?: ArraysEntry;
+        round_robin_arrays?: (...args: [...Parameters<ArraysEntry>, number]) => void;
+        priority_scheduling_arrays?: ArraysEntry;
+        srtf_arrays?: ArraysEntry;
+        preemptive_priority_arrays?: ArraysEntry;
         delete: () => void;
     };
+    // Present on the compiled WASM modules only. Re-read HEAP32 after every
+    // call: memory growth replaces the underlying buffer.
+    _malloc?: (bytes: number) => number;
+    _free?: (ptr: number) => void;
+    HEAP32?: Int32Array;
     Process: new () => Process;
     'vector<Process>': new () => {
         push_back: (p: Process) => void;
@@ -26,6 +60,81 @@ export interface SchedulerModule {
     };
 }
 
+// Policy ids accepted by BatchScheduler.sweep
+export enum SchedulingPolicy {
+    FCFS = 0,
+    SJF = 1,
+    RoundRobin = 2,
+    Priority = 3,
+    SRTF = 4,
+    PreemptivePriority = 5,
+}
+
+export interface SweepMetrics {
+    workload: number;
+    policy: SchedulingPolicy;
+    mean_waiting: number;
+    p95_waiting: number;
+    mean_turn_around: number;
+    p95_turn_around: number;
+    throughput: number;
+    cpu_utilisation: number;
+}
+
+export interface SweepModule {
+    BatchScheduler: new () => {
+        // processes: every workload back to back, offsets: workload boundaries (length W + 1)
+        sweep: (processes: any, offsets: any, policies: any, quantum: number, threads: number) => any; // vector<SweepMetrics>
+        delete: () => void;
+    };
+    'vector<Process>': new () => any;
+    'vector<int>': new () => any;
+}
+
+// Incremental scheduler: push arrival-ordered chunks, get back the processes
+// that finished (vector<Process>, completion order); finish() drains the rest
+export interface StreamingModule {
+    StreamingScheduler: new (policy: SchedulingPolicy, quantum: number) => {
+        push: (chunk: any) => any;
+        finish: () => any;
+        live: () => number;
+        delete: () => void;
+    };
+    'vector<Process>': new () => any;
+}
+
+// Multi-core simulator (MulticoreScheduler.simulate); supports FCFS, SJF, RoundRobin and Priority
+export enum BalancingMode {
+    Global = 0,
+    Push = 1,
+    Steal = 2,
+}
+
+export interface CoreStats {
+    core: number;
+    busy_time: number;
+    utilisation: number;
+    dispatches: number;
+    stolen: number;
+}
+
+export interface MulticoreResult {
+    processes: any; // vector<Process>
+    cores: any; // vector<CoreStats>
+    makespan: number;
+    migrations: number;
+    balance_moves: number;
+    imbalance: number;
+}
+
+export interface MulticoreModule {
+    MulticoreScheduler: new () => {
+        simulate: (processes: any, cores: number, policy: SchedulingPolicy, balancing: BalancingMode, quantum: number) => MulticoreResult;
+        delete: () => void;
+    };
+    'vector<Process>': new () => any;
+}
+
 // Memory Types
 export interface MemoryBlock {
     id: number;
@@ -57,6 +166,58 @@ export interface MemoryFitModule {
     'vector<ProcessRequest>': new () => any;
 }
 
+export enum AllocEventType {
+    Alloc = 0,
+    Free = 1,
+}
+
+export enum AllocatorPolicy {
+    FirstFit = 0,
+    NextFit = 1,
+    BestFit = 2,
+    WorstFit = 3,
+    Buddy = 4,
+    Slab = 5,
+}
+
+export interface AllocEvent {
+    type: AllocEventType;
+    id: number;
+    size: number; // Ignored for frees
+}
+
+export interface AllocSample {
+    event: number;
+    requested: number;
+    reserved: number;
+    free_blocks: number;
+    largest_free: number;
+    external_fragmentation: number;
+    internal_fragmentation: number;
+    mean_search_length: number; // Since the previous sample
+    failures: number;
+}
+
+export interface AllocatorResult {
+    samples: any; // vector<AllocSample>
+    allocations: number;
+    frees: number;
+    failures: number;
+    peak_requested: number;
+    peak_reserved: number;
+    mean_search_length: number;
+    max_search_length: number;
+}
+
+export interface AllocatorModule {
+    AllocatorSimulator: new () => {
+        // sampleInterval <= 0 samples only after the last event
+        simulate: (events: any, policy: AllocatorPolicy, heapSize: number, sampleInterval: number) => AllocatorResult;
+        delete: () => void;
+    };
+    'vector<AllocEvent>': new () => any;
+}
+
 export interface PageStep {
     page: number;
     step: number;
@@ -64,6 +225,45 @@ export interface PageStep {
     fault: boolean;
 }
 
+// Policy ids for PageReplacement.history and faults
+export enum PagePolicy {
+    FIFO = 0,
+    LRU = 1,
+    Optimal = 2,
+    LFU = 3,
+    MFU = 4,
+    Clock = 5,
+    ARC = 6,
+    TwoQueue = 7,
+    LIRS = 8,
+}
+
+export interface PageEvent {
+    page: number;
+    fault: boolean;
+    slot: number;
+    evicted: boolean;
+    evicted_page: number;
+}
+
+// Compact step history; frames are rebuilt on demand from periodic keyframes.
+// A step outside [0, size()) gives page -1 and no frames.
+export interface PageHistory {
+    size: () => number;
+    faults: () => number;
+    event: (step: number) => PageEvent;
+    frames_at: (step: number) => any; // vector<int>
+    step_at: (step: number) => PageStep;
+    delete: () => void;
+}
+
+export interface MissRatioCurve {
+    references: number;
+    distinct_pages: number;
+    faults: any; // vector<int>, faults[c - 1] for capacity c
+    miss_ratio: any; // vector<double>
+}
+
 export interface PageReplacementModule {
     PageReplacement: new () => {
         fifo: (pages: any, capacity: number) => any; // vector<PageStep>
@@ -71,29 +271,202 @@ export interface PageReplacementModule {
         optimal: (pages: any, capacity: number) => any;
         lfu: (pages: any, capacity: number) => any;
         mfu: (pages: any, capacity: number) => any;
+        clock?: (pages: any, capacity: number) => any;
+        arc?: (pages: any, capacity: number) => any;
+        two_queue?: (pages: any, capacity: number) => any;
+        lirs?: (pages: any, capacity: number) => any;
+        // Fault counts without the step history
+        lru_faults?: (pages: any, capacity: number) => number;
+        optimal_faults?: (pages: any, capacity: number) => number;
+        lfu_faults?: (pages: any, capacity: number) => number;
+        mfu_faults?: (pages: any, capacity: number) => number;
+        faults?: (pages: any, capacity: number, policy: PagePolicy) => number;
+        // Faults for every capacity 1..maxCapacity in one pass
+        lru_curve?: (pages: any, maxCapacity: number) => MissRatioCurve;
+        optimal_curve?: (pages: any, maxCapacity: number) => MissRatioCurve;
+        // keyframeInterval <= 0 picks a default
+        history?: (pages: any, capacity: number, policy: PagePolicy, keyframeInterval: number) => PageHistory;
         delete: () => void;
     };
     'vector<int>': new () => any;
     'vector<PageStep>': new () => any;
 }
 
+export enum TlbPolicy {
+    LRU = 0,
+    FIFO = 1,
+    Random = 2,
+}
+
+export interface TranslationConfig {
+    page_bits: number;
+    level_bits: any; // vector<int>, root level first
+    tlb_sets: number;
+    tlb_ways: number;
+    tlb_policy: TlbPolicy;
+    frames: number;
+    page_policy: PagePolicy;
+    tlb_hit_cycles: number;
+    memory_cycles: number; // Per page-table entry read
+    fault_cycles: number;
+}
+
+export interface TranslationResult {
+    accesses: number;
+    tlb_hits: number;
+    tlb_misses: number;
+    tlb_hit_rate: number;
+    page_walks: number;
+    walk_reads: number;
+    page_faults: number;
+    evictions: number;
+    shootdowns: number;
+    page_tables: number;
+    cycles: number;
+    cycles_per_access: number;
+}
+
+export interface TranslationModule {
+    default_translation_config: () => TranslationConfig;
+    TranslationSimulator: new () => {
+        // addresses: vector<double>, exact up to 2^53
+        simulate: (addresses: any, config: TranslationConfig) => TranslationResult;
+        delete: () => void;
+    };
+    'vector<int>': new () => any;
+    'vector<double>': new () => any;
+}
+
 // Disk Types
 export interface DiskResult {
     seek_sequence: any; // vector<int>
     total_seek_count: number;
 }
 
+export interface DiskComparison {
+    fcfs: number;
+    sstf: number;
+    scan: number;
+    c_scan: number;
+    look: number;
+    c_look: number;
+}
+
+// Algorithm ids for DiskScheduler.trace
+export enum DiskAlgorithm {
+    FCFS = 0,
+    SSTF = 1,
+    SCAN = 2,
+    CSCAN = 3,
+    LOOK = 4,
+    CLOOK = 5,
+}
+
+export enum DiskOutput {
+    Summary = 0,
+    Runs = 1,
+}
+
+export interface SeekSummary {
+    total_seek: number;
+    moves: number;
+    max_seek: number;
+    mean_seek: number;
+    reversals: number;
+}
+
+// Run-length seek sequence: from start(), the head moves by runs[2k]
+// cylinders runs[2k + 1] times. View the runs without copying as
+// HEAP32.subarray(runs_data() >> 2, (runs_data() >> 2) + 2 * run_count()).
+export interface SeekTrace {
+    start: () => number;
+    summary: () => SeekSummary;
+    run_count: () => number;
+    runs_data: () => number;
+    decode: () => any; // vector<int>, the full seek_sequence
+    delete: () => void;
+}
+
 export interface DiskSchedulerModule {
     DiskScheduler: new () => {
         fcfs: (requests: any, head: number) => DiskResult;
         sstf: (requests: any, head: number) => DiskResult;
         scan: (requests: any, head: number, size: number, dir: number) => DiskResult;
         c_scan: (requests: any, head: number, size: number) => DiskResult;
+        look?: (requests: any, head: number, dir: number) => DiskResult;
+        c_look?: (requests: any, head: number) => DiskResult;
+        // Total seek counts of all six from one sort; SCAN and LOOK start upwards
+        compare_all?: (requests: any, head: number, size: number) => DiskComparison;
+        // No seek_sequence vector; Runs also keeps the run-length sequence.
+        // An unknown algorithm or output gives summary().moves === -1
+        trace?: (requests: any, algorithm: DiskAlgorithm, head: number, size: number, dir: number, output: DiskOutput) => SeekTrace;
+        // requests: byte offset of n int32s allocated with _malloc
+        trace_array?: (requests: number, n: number, algorithm: DiskAlgorithm, head: number, size: number, dir: number, output: DiskOutput) => SeekTrace;
         delete: () => void;
     };
+    _malloc?: (bytes: number) => number;
+    _free?: (ptr: number) => void;
+    HEAP32?: Int32Array;
     'vector<int>': new () => any;
 }
 
+// Policy ids for DiskSimulator.simulate
+export enum DiskSimPolicy {
+    FCFS = 0,
+    SSTF = 1,
+    LOOK = 2,
+    CLOOK = 3,
+    NStepScan = 4,
+    FScan = 5,
+    Deadline = 6,
+}
+
+// Times in milliseconds
+export interface DiskRequest {
+    id: number;
+    arrival_time: number;
+    cylinder: number;
+    deadline: number; // Absolute; <= 0 for none
+}
+
+export interface DiskModel {
+    settle_ms: number;
+    seek_factor_ms: number; // Seek is settle_ms + seek_factor_ms * sqrt(distance)
+    rpm: number;
+    transfer_ms: number;
+}
+
+export interface DiskCompletion {
+    id: number;
+    start_time: number;
+    finish_time: number;
+    latency: number;
+    missed_deadline: boolean;
+}
+
+export interface DiskSimResult {
+    requests: any; // vector<DiskCompletion>, input order
+    mean_latency: number;
+    p50_latency: number;
+    p95_latency: number;
+    p99_latency: number;
+    max_latency: number;
+    throughput: number; // Requests per second
+    utilisation: number;
+    mean_seek_distance: number;
+    missed_deadlines: number;
+}
+
+export interface DiskSimulatorModule {
+    default_disk_model: () => DiskModel;
+    DiskSimulator: new () => {
+        // batchSize is N for N-step SCAN
+        simulate: (requests: any, policy: DiskSimPolicy, model: DiskModel, head: number, batchSize: number) => DiskSimResult;
+        delete: () => void;
+    };
+    'vector<DiskRequest>': new () => any;
+}
+
 // Deadlock Types
 export interface BankerResult {
     is_safe: boolean;
@@ -142,3 +515,55 @@ export interface FileAllocationModule {
     'vector<DiskBlock>': new () => any;
     'vector<int>': new () => any;
 }
+
+export enum FsEventType {
+    Create = 0,
+    Append = 1,
+    Truncate = 2, // To `blocks`; only ever shrinks
+    Delete = 3,
+    Defrag = 4,
+}
+
+export enum FsLayout {
+    Contiguous = 0,
+    Linked = 1,
+    Indexed = 2,
+    Extent = 3,
+}
+
+export interface FsEvent {
+    type: FsEventType;
+    file: number;
+    blocks: number;
+}
+
+export interface FsSample {
+    event: number;
+    files: number;
+    used_blocks: number;
+    free_blocks: number;
+    largest_free_run: number;
+    external_fragmentation: number;
+    mean_extents: number; // Per non-empty file
+    fragmented_files: number;
+    failures: number;
+}
+
+export interface FsResult {
+    samples: any; // vector<FsSample>
+    creates: number;
+    deletes: number;
+    failures: number;
+    relocated_blocks: number; // Copied by contiguous files growing
+    defrag_passes: number;
+    defrag_moved_blocks: number;
+}
+
+export interface FsSimulatorModule {
+    FileSystemSimulator: new () => {
+        // sampleInterval <= 0 samples only after the last event
+        simulate: (events: any, layout: FsLayout, totalBlocks: number, sampleInterval: number) => FsResult;
+        delete: () => void;
+    };
+    'vector<FsEvent>': new () => any;
+}